@@ -22,6 +22,26 @@
 // Port registers are same size as a pointer (16-bit on AVR, 32-bit on ARM)
 typedef intptr_t port_reg_t;
 
+// Bits of BaseDMD::triple_state
+const uint8_t TRIPLE_INDEX = 0x03;
+const uint8_t TRIPLE_FRESH = 0x80; // middle buffer holds a newly committed frame
+const uint8_t TRIPLE_OFF = 0x00; // state when triple buffering isn't running (never fresh)
+
+// Exchange a byte shared with the timer ISR
+static inline uint8_t atomicExchange(volatile uint8_t *value, uint8_t new_value)
+{
+#if defined(__arm__)
+  return __sync_lock_test_and_set(value, new_value);
+#else
+  // A byte write is atomic on AVR, but the read-then-write isn't
+  DMDInterruptState state = saveInterrupts();
+  uint8_t old = *value;
+  *value = new_value;
+  restoreInterrupts(state);
+  return old;
+#endif
+}
+
 SPIDMD::SPIDMD(byte panelsWide, byte panelsHigh)
 #ifdef ESP8266
   : BaseDMD(panelsWide, panelsHigh, 15, 16, 12, 0)
@@ -66,24 +86,45 @@ void SPIDMD::writeSPIData(volatile uint8_t *rows[4], const int rowsize)
 
 void BaseDMD::scanDisplay()
 {
-  if(pin_other_cs >= 0 && digitalRead(pin_other_cs) != HIGH)
+#ifdef DMD_SCAN_STATS
+  uint32_t scan_start = DMD_STATS_CLOCK();
+  scan_stats.recordStart(scan_start);
+#endif
+  if(pin_other_cs >= 0 && digitalRead(pin_other_cs) != HIGH) {
+#ifdef DMD_SCAN_STATS
+    scan_stats.skipped++;
+#endif
     return;
-  // Rows are send out in 4 blocks of 4 (interleaved), across all panels
-
-  int rowsize = unified_width_bytes();
+  }
 
-  volatile uint8_t *rows[4] = { // Scanning out 4 interleaved rows
-    bitmap + (scan_row + 0) * rowsize,
-    bitmap + (scan_row + 4) * rowsize,
-    bitmap + (scan_row + 8) * rowsize,
-    bitmap + (scan_row + 12) * rowsize,
-  };
+  if(scan_row == 0) {
+    // Start of a new frame, so now is the time to swap in any frame from present() or commitFrame()
+    if(present_pending) {
+      swapBuffers(*present_frame);
+      present_pending = false;
+      if(present_callback)
+        present_callback(*this);
+    }
+    if(canvas_pending) {
+      canvas = next_canvas;
+      view_x = next_view_x;
+      view_y = next_view_y;
+      canvas_pending = false;
+    }
+    if(triple_state & TRIPLE_FRESH) {
+      // Nothing else can run in the middle of the ISR, so no need for an atomic exchange here
+      uint8_t middle = triple_state & TRIPLE_INDEX;
+      triple_state = triple_front;
+      triple_front = middle;
+      bitmap = triple_buffers[middle];
+    }
+  }
 
-  writeSPIData(rows, rowsize);
+  writeScanRows();
 
-  digitalWrite(pin_noe, LOW);
-  digitalWrite(pin_sck, HIGH); // Latch DMD shift register output
-  digitalWrite(pin_sck, LOW); // (Deliberately left as digitalWrite to ensure decent latching time)
+  writeScanPin(pin_noe, LOW);
+  writeScanPin(pin_sck, HIGH); // Latch DMD shift register output
+  writeScanPin(pin_sck, LOW); // (Deliberately a plain digitalWrite to ensure decent latching time)
 
   // Digital outputs A, B are a 2-bit selector output, set from the scan_row variable (loops over 0-3),
   // that determines which set of interleaved rows we are outputting during this pass.
@@ -91,15 +132,206 @@ void BaseDMD::scanDisplay()
   // BA 1 (01) = 2,6,10,14
   // BA 2 (10) = 3,7,11,15
   // BA 3 (11) = 4,8,12,16
-  digitalWrite(pin_a, scan_row & 0x01);
-  digitalWrite(pin_b, scan_row & 0x02);
+  writeScanPin(pin_a, scan_row & 0x01);
+  writeScanPin(pin_b, scan_row & 0x02);
   scan_row = (scan_row + 1) % 4;
 
   // Output enable pin is either fixed on, or PWMed for a variable brightness display
   if(brightness == 255)
-    digitalWrite(pin_noe, HIGH);
+    writeScanPin(pin_noe, HIGH);
   else
-    analogWrite(pin_noe, brightness);
+    writeScanBrightness(pin_noe, brightness);
+
+#ifdef DMD_SCAN_STATS
+  scan_stats.recordScan(scan_start, DMD_STATS_CLOCK());
+#endif
+}
+
+// Send out the 4 interleaved rows for the current scan_row, across all panels
+void BaseDMD::writeScanRows()
+{
+  // Rows are send out in 4 blocks of 4 (interleaved), across all panels
+
+  int rowsize = unified_width_bytes();
+
+  if(canvas) {
+    writeCanvasRows();
+    return;
+  }
+
+  if(row_offset) {
+    // Ring rows mode, stored rows aren't in order so send each row of panels separately.
+    // This shifts out the same bytes as one unified row would.
+    for(byte band = 0; band < height_in_panels; band++) {
+      unsigned int y = band * PANEL_HEIGHT + scan_row;
+      volatile uint8_t *rows[4] = {
+        bitmap + rowToBitmapIndex(y + 0),
+        bitmap + rowToBitmapIndex(y + 4),
+        bitmap + rowToBitmapIndex(y + 8),
+        bitmap + rowToBitmapIndex(y + 12),
+      };
+      writeSPIData(rows, row_width_bytes);
+    }
+    return;
+  }
+
+  volatile uint8_t *rows[4] = { // Scanning out 4 interleaved rows
+    bitmap + (scan_row + 0) * rowsize,
+    bitmap + (scan_row + 4) * rowsize,
+    bitmap + (scan_row + 8) * rowsize,
+    bitmap + (scan_row + 12) * rowsize,
+  };
+
+  writeSPIData(rows, rowsize);
+}
+
+// Send out the 4 interleaved rows for the current scan_row from the part of the canvas in the viewport
+void BaseDMD::writeCanvasRows()
+{
+  const unsigned int first_byte = view_x / 8;
+  const byte shift = view_x & 0x07;
+
+  for(byte band = 0; band < height_in_panels; band++) {
+    unsigned int y = view_y + band * PANEL_HEIGHT + scan_row;
+    volatile uint8_t *rows[4];
+    for(byte r = 0; r < 4; r++) {
+      volatile uint8_t *src = canvas->bitmap + canvas->rowToBitmapIndex(y + r * 4) + first_byte;
+      if(shift) {
+        // Viewport doesn't start on a byte boundary, so shift the row into place. The last
+        // byte takes its low bits from the byte past the viewport, which is still in the canvas.
+        uint8_t *shifted = shift_buffer + r * row_width_bytes;
+        for(byte i = 0; i < row_width_bytes; i++)
+          shifted[i] = (src[i] << shift) | (src[i+1] >> (8 - shift));
+        rows[r] = shifted;
+      }
+      else {
+        rows[r] = src;
+      }
+    }
+    writeSPIData(rows, row_width_bytes);
+  }
+}
+
+#ifdef DMD2_HOST
+void BaseDMD::writeScanPin(byte pin, byte value)
+{
+  digitalWrite(pin, value);
+}
+
+void BaseDMD::writeScanBrightness(byte pin, byte level)
+{
+  analogWrite(pin, level);
+}
+#endif
+
+bool BaseDMD::present(DMDFrame &frame)
+{
+  if(!presentAsync(frame))
+    return false;
+  while(present_pending)
+    ; // Timer ISR swaps the frame in at the start of the next scan
+  return true;
+}
+
+bool BaseDMD::presentAsync(DMDFrame &frame, void (*callback)(BaseDMD &dmd))
+{
+  if(frame.width != width || frame.height != height || present_pending)
+    return false;
+  // The ISR reads all three together (and AVR can't write pointers atomically)
+  DMDInterruptState state = saveInterrupts();
+  present_frame = &frame;
+  present_callback = callback;
+  present_pending = true;
+  restoreInterrupts(state);
+  return true;
+}
+
+bool BaseDMD::setCanvas(DMDFrame *canvas)
+{
+  if(canvas && (canvas->width < width || canvas->height < height))
+    return false;
+  if(canvas && !shift_buffer) {
+    shift_buffer = (uint8_t *)malloc(4 * row_width_bytes);
+    if(!shift_buffer)
+      return false;
+  }
+  // AVR can't write pointers atomically, so need to disable interrupts
+  DMDInterruptState state = saveInterrupts();
+  next_canvas = canvas;
+  next_view_x = 0;
+  next_view_y = 0;
+  canvas_pending = true;
+  restoreInterrupts(state);
+  return true;
+}
+
+void BaseDMD::setViewport(unsigned int x, unsigned int y)
+{
+  DMDFrame *canvas = next_canvas;
+  if(!canvas)
+    return;
+  // Keep the whole display inside the canvas
+  clamp(x, 0U, (unsigned int)(canvas->width - width));
+  clamp(y, 0U, (unsigned int)(canvas->height - height));
+  DMDInterruptState state = saveInterrupts();
+  next_view_x = x;
+  next_view_y = y;
+  canvas_pending = true;
+  restoreInterrupts(state);
+}
+
+DMDFrame *BaseDMD::beginTripleBuffering()
+{
+  if(triple_frame)
+    return triple_frame;
+
+  triple_frame = new DMDFrame(width, height);
+  uint8_t *spare = (uint8_t *)malloc(bitmap_bytes());
+  if(!triple_frame || !triple_frame->bitmap || !spare) {
+    free(spare);
+    delete triple_frame;
+    triple_frame = NULL;
+    return NULL;
+  }
+  memset(spare, 0xFF, bitmap_bytes());
+
+  triple_buffers[0] = bitmap;
+  triple_buffers[1] = triple_frame->bitmap;
+  triple_buffers[2] = spare;
+  triple_front = 0;
+  triple_back = 1;
+  atomicExchange(&triple_state, 2);
+  return triple_frame;
+}
+
+void BaseDMD::commitFrame(bool keep_contents)
+{
+  if(!triple_frame)
+    return;
+  // Committed frame becomes the middle buffer, and we get the old middle buffer back
+  uint8_t old_middle = atomicExchange(&triple_state, triple_back | TRIPLE_FRESH);
+  volatile uint8_t *committed = triple_buffers[triple_back];
+  triple_back = old_middle & TRIPLE_INDEX;
+  triple_frame->bitmap = triple_buffers[triple_back];
+  if(keep_contents)
+    memcpy((void *)triple_frame->bitmap, (void *)committed, bitmap_bytes());
+}
+
+void BaseDMD::endTripleBuffering()
+{
+  if(!triple_frame)
+    return;
+  DMDInterruptState state = saveInterrupts();
+  // Whatever is showing stays as the display buffer, the frame takes one of the others with it
+  uint8_t front = triple_front;
+  triple_state = TRIPLE_OFF;
+  restoreInterrupts(state);
+  uint8_t other = (front + 1) % 3;
+  uint8_t spare = (front + 2) % 3;
+  triple_frame->bitmap = triple_buffers[other];
+  free((void *)triple_buffers[spare]);
+  delete triple_frame;
+  triple_frame = NULL;
 }
 
 #ifdef ESP8266
@@ -177,8 +409,30 @@ BaseDMD::BaseDMD(byte panelsWide, byte panelsHigh, byte pin_noe, byte pin_a, byt
   default_pins(pin_noe == 9 && pin_a == 6 && pin_b == 7 && pin_sck == 8),
 #endif
   pin_other_cs(-1),
-  brightness(255)
+  brightness(255),
+  present_frame(NULL),
+  present_callback(NULL),
+  present_pending(false),
+  triple_frame(NULL),
+  triple_state(TRIPLE_OFF),
+  canvas(NULL),
+  view_x(0),
+  view_y(0),
+  next_canvas(NULL),
+  next_view_x(0),
+  next_view_y(0),
+  canvas_pending(false),
+  shift_buffer(NULL)
+{
+#ifdef DMD_SCAN_STATS
+  scan_stats.reset();
+#endif
+}
+
+BaseDMD::~BaseDMD()
 {
+  endTripleBuffering(); // frees the extra buffers
+  free(shift_buffer);
 }
 
 void BaseDMD::beginNoTimer()
@@ -198,3 +452,54 @@ void BaseDMD::beginNoTimer()
   clearScreen();
   scanDisplay();
 }
+
+#ifdef DMD_SCAN_STATS
+
+void DMDScanStats::reset()
+{
+  memset(this, 0, sizeof(DMDScanStats));
+}
+
+// Record the start of a scan (called for skipped scans as well), updates the interval histogram
+void DMDScanStats::recordStart(uint32_t now)
+{
+  if(scans || skipped) {
+    uint32_t bin = (now - last_start) >> DMD_STATS_BIN_SHIFT;
+    if(bin >= DMD_STATS_HISTOGRAM_BINS)
+      bin = DMD_STATS_HISTOGRAM_BINS - 1;
+    intervals[bin]++;
+  } else {
+    first_start = now;
+  }
+  last_start = now;
+}
+
+// Record a completed scan
+void DMDScanStats::recordScan(uint32_t start, uint32_t end)
+{
+  uint32_t elapsed = end - start;
+  if(!scans || elapsed < min_time)
+    min_time = elapsed;
+  if(elapsed > max_time)
+    max_time = elapsed;
+  scans++;
+  total_time += elapsed;
+  last_end = end;
+}
+
+void BaseDMD::getScanStats(DMDScanStats &stats)
+{
+  // Stats are updated from the timer ISR, so copy them with interrupts off
+  DMDInterruptState state = saveInterrupts();
+  stats = scan_stats;
+  restoreInterrupts(state);
+}
+
+void BaseDMD::resetScanStats()
+{
+  DMDInterruptState state = saveInterrupts();
+  scan_stats.reset();
+  restoreInterrupts(state);
+}
+
+#endif // DMD_SCAN_STATS
@@ -26,8 +26,19 @@
 #define DMD2_H
 
 #include "Print.h"
+#include "Stream.h"
 #include "SPI.h"
 
+/*
+  Uncomment the following line to build in timing statistics for the
+  display scanning code (see DMDScanStats below.) This adds a small
+  amount of overhead to every scan, so it is off by default.
+
+  The timestamp source can be replaced by defining DMD_STATS_CLOCK
+  (for example with a cycle counter, or a simulated clock.)
+*/
+//#define DMD_SCAN_STATS
+
 // Dimensions of a single display
 const unsigned int PANEL_WIDTH = 32;
 const unsigned int PANEL_HEIGHT = 16;
@@ -52,6 +63,50 @@ template<typename T> static inline void ensureOrder(T &a, T &b)
   if(b<a) swap(a,b);
 }
 
+/* Turn interrupts off while changing data shared with the timer ISR. Returns the
+   previous interrupt state, to pass to restoreInterrupts() afterwards, so this is
+   safe to call with interrupts already off (eg from a callback run by the ISR.) */
+#ifdef __AVR__
+typedef uint8_t DMDInterruptState;
+#else
+typedef uint32_t DMDInterruptState;
+#endif
+
+static inline DMDInterruptState saveInterrupts()
+{
+#ifdef __AVR__
+  uint8_t oldSREG = SREG;
+  cli();
+  return oldSREG;
+#elif defined(ESP8266)
+  return xt_rsil(15);
+#elif defined(__arm__)
+  uint32_t primask;
+  asm volatile ("mrs %0, primask" : "=r" (primask));
+  asm volatile ("cpsid i" ::: "memory");
+  return primask;
+#else
+  // No way to read the state back, so assume interrupts were on
+  noInterrupts();
+  return 1;
+#endif
+}
+
+static inline void restoreInterrupts(DMDInterruptState state)
+{
+#ifdef __AVR__
+  SREG = state;
+#elif defined(ESP8266)
+  xt_wsr_ps(state);
+#elif defined(__arm__)
+  if(!(state & 1)) // PRIMASK was clear, interrupts were on
+    asm volatile ("cpsie i" ::: "memory");
+#else
+  if(state)
+    interrupts();
+#endif
+}
+
 extern const uint8_t DMD_Pixel_Lut[]; /* Lookup table for the DMD pixel locations */
 
 enum DMDTestPattern {
@@ -72,6 +127,13 @@ enum DMDGraphicsMode {
     GRAPHICS_NOOP // No-Op, ie don't actually change anything
 };
 
+// Horizontal alignment of lines of text (see DMD_TextLayout)
+enum DMDTextAlign {
+  ALIGN_LEFT,
+  ALIGN_CENTER,
+  ALIGN_RIGHT
+};
+
 // Return the inverse/"clear" version of the given mode
 // ie for normal pixel-on modes, the "clear" is to turn off.
 // for inverse mode, it's to turn on.
@@ -87,7 +149,243 @@ inline static DMDGraphicsMode inverseMode(DMDGraphicsMode mode) {
   }
 };
 
+// Bit operations that apply a graphics mode to the pixels selected by a mask in
+// one bitmap byte (where bits set = off):  byte = ((byte & and_mask) | or_mask) ^ xor_mask
+struct DMDBitOp {
+  uint8_t and_mask;
+  uint8_t or_mask;
+  uint8_t xor_mask;
+
+  inline uint8_t apply(uint8_t value) { return ((value & and_mask) | or_mask) ^ xor_mask; }
+};
+
+// GRAPHICS_INVERSE is treated as a no-op here, same as for setPixel()
+inline static DMDBitOp modeBitOp(DMDGraphicsMode mode, uint8_t mask) {
+  DMDBitOp op = { 0xFF, 0, 0 };
+  switch(mode) {
+    case GRAPHICS_ON:
+    case GRAPHICS_OR:
+      op.and_mask = ~mask;
+      break;
+    case GRAPHICS_OFF:
+    case GRAPHICS_NOR:
+      op.or_mask = mask;
+      break;
+    case GRAPHICS_XOR:
+      op.xor_mask = mask;
+      break;
+    default:
+      break;
+  }
+  return op;
+}
+
+// Operation which draws the pixels in 'set' with set_mode, and the other pixels in 'mask'
+// with clear_mode (eg a glyph and its background.) The two groups of pixels don't overlap,
+// so their operations can be merged.
+inline static DMDBitOp glyphBitOp(DMDGraphicsMode set_mode, DMDGraphicsMode clear_mode, uint8_t set, uint8_t mask) {
+  DMDBitOp op = modeBitOp(set_mode, set);
+  DMDBitOp clear_op = modeBitOp(clear_mode, mask & ~set);
+  op.and_mask &= clear_op.and_mask;
+  op.or_mask |= clear_op.or_mask;
+  op.xor_mask |= clear_op.xor_mask;
+  return op;
+}
+
 class DMD_TextBox;
+class DMD_TextStrip;
+class DMD_Ticker;
+class DMD_TextLayout;
+class DMD_StreamReceiver;
+class DMD_Timeline;
+class DMD_Transition;
+class DMD_Dither;
+
+// Six byte header at beginning of FontCreator font structure, stored in PROGMEM
+struct FontHeader {
+  uint16_t size;
+  uint8_t fixedWidth;
+  uint8_t height;
+  uint8_t firstChar;
+  uint8_t charCount;
+};
+
+/* Value of FontHeader::size for a packed font, made from a FontCreator font with
+   extras/fontpack.py. Packed fonts have the same header and widths table, but each glyph
+   only stores the rows between its top and bottom pixels, with no padding out to whole
+   bytes. They can be used anywhere a FontCreator font can. */
+#define DMD_PACKED_FONT 0xFFFF
+
+/* Value of FontHeader::size for a sparse font, made from one or more FontCreator fonts with
+   extras/fontsparse.py. A sparse font holds any set of characters up to U+FFFF (accented
+   letters, Cyrillic, symbols...) without storing the gaps between them. charCount is the
+   number of entries in a table of ranges of consecutive characters, which is binary
+   searched to find a glyph, and fixedWidth is the width of a space.
+
+   Text drawn in a sparse font is read as UTF-8, by drawString(), stringWidth(),
+   DMD_TextBox, DMD_TextStrip, DMD_Ticker and DMD_TextLayout. Other fonts read text one
+   byte per character, as before. */
+#define DMD_SPARSE_FONT 0xFEFE
+
+/* Decodes UTF-8 one byte at a time. decode() returns the character once its last byte
+   has been read, and DMD_UTF8_PENDING before that. Bytes that aren't valid UTF-8 are
+   returned as they are (ie read as Latin-1), and characters above U+FFFF come out as
+   U+FFFD (the replacement character.) */
+#define DMD_UTF8_PENDING 0xFFFF
+
+struct DMD_UTF8Decoder {
+  DMD_UTF8Decoder() : codepoint(0), remaining(0) { }
+  inline uint16_t decode(uint8_t c) {
+    if(c < 0x80) { // ASCII, drops any unfinished sequence
+      remaining = 0;
+      return c;
+    }
+    return decodeSequence(c);
+  }
+  // True if in the middle of a multi-byte character
+  inline bool pending() { return remaining != 0; }
+  inline void reset() { remaining = 0; }
+private:
+  uint32_t codepoint;
+  uint8_t remaining; // continuation bytes still to come
+  uint16_t decodeSequence(uint8_t c);
+};
+
+/* A font that isn't stored in PROGMEM, selected with DMDFrame::selectFont(DMDFontSource &).
+   drawChar(), drawString(), stringWidth(), charWidth() and DMD_TextBox can all use it as
+   the selected font. (DMD_TextStrip, DMD_Ticker and DMD_TextLayout need a PROGMEM font.) */
+class DMDFontSource {
+public:
+  virtual ~DMDFontSource() { }
+  // Get the font ready and read its header, returns false if it can't be used
+  virtual bool begin(FontHeader &header) = 0;
+  // Width of a character as drawn by drawChar(), 0 if it isn't in the font
+  virtual uint8_t charWidth(uint16_t letter) = 0;
+  // Glyph data for a character (FontCreator layout, in RAM) and its width, or NULL if it
+  // isn't in the font. The data only needs to stay valid until the next call.
+  virtual const uint8_t *glyphData(uint16_t letter, uint8_t &width) = 0;
+};
+
+/* A font read from storage as it's needed, see DMD2_SDFont.h for fonts on an SD card.
+
+   The file holds the same bytes as a PROGMEM font (extras/fontbin.py writes one from a font
+   header), either a FontCreator fixed or variable width font or a sparse font. Packed fonts
+   aren't supported. The header and table of glyph offsets (or of ranges, for a sparse font)
+   are read by begin(), and the most recently used glyphs are kept in a cache in RAM, so only
+   glyphs that aren't in the cache cost a read.
+
+   Subclasses implement readAt() for their storage. */
+#ifndef DMD_FONT_CACHE_GLYPHS
+#define DMD_FONT_CACHE_GLYPHS 8
+#endif
+
+class DMD_CachedFont : public DMDFontSource {
+public:
+  DMD_CachedFont(uint8_t cacheGlyphs = DMD_FONT_CACHE_GLYPHS);
+  virtual ~DMD_CachedFont();
+
+  virtual bool begin(FontHeader &header);
+  virtual uint8_t charWidth(uint16_t letter);
+  virtual const uint8_t *glyphData(uint16_t letter, uint8_t &width);
+
+  // Number of glyphs read into the cache so far
+  uint32_t getGlyphReads() { return glyph_reads; }
+protected:
+  // Read 'length' bytes from 'position' in the font, returns false if they couldn't be read
+  virtual bool readAt(uint32_t position, uint8_t *buf, uint16_t length) = 0;
+private:
+  DMD_CachedFont(const DMD_CachedFont &); // not copyable
+
+  FontHeader header;
+  uint8_t column_bytes; // bytes in each column of a glyph
+  uint16_t *offsets; // FontCreator fonts, data offset of each glyph and the end of the data
+  uint8_t *ranges; // sparse fonts, the table of ranges
+
+  /* Cache of glyphs, each slot has room for the widest glyph in the font. For sparse fonts
+     charWidth() keeps the width and data position it looked up in a slot without reading
+     the glyph, so drawing the character next doesn't look it up again. */
+  struct Slot {
+    uint16_t letter;
+    uint8_t width;
+    uint16_t index; // position of the glyph data
+    bool loaded; // glyph data has been read into the slot
+    uint16_t last_used;
+  };
+  uint8_t cache_glyphs;
+  uint16_t slot_bytes;
+  Slot *slots;
+  uint8_t *cache_data;
+  uint16_t use_count;
+  uint32_t glyph_reads;
+
+  void freeTables();
+  bool readTables(uint8_t &widest);
+  bool findGlyph(uint16_t letter, uint8_t &width, uint16_t &index);
+  Slot *findSlot(uint16_t letter);
+  Slot *loadSlot(uint16_t letter);
+  void touchSlot(Slot *slot);
+};
+
+/* selectFont() caches the font header, and for variable width fonts a table of glyph data
+   offsets so finding a glyph doesn't mean adding up the widths of all the glyphs before it.
+   To save RAM on AVR only every 8th offset is stored (24 bytes for a 96 character font),
+   and the widths of up to 7 glyphs are added to that. */
+#ifdef __AVR__
+#define DMD_GLYPH_OFFSET_STRIDE 8
+#else
+#define DMD_GLYPH_OFFSET_STRIDE 1
+#endif
+
+// Default rule for DMDFrame::stepLife(), Conway's Game of Life (B3/S23): bit n is set if a
+// pixel with n neighbours that are on is born (turns on), or survives (stays on)
+#define DMD_LIFE_BIRTH (1 << 3)
+#define DMD_LIFE_SURVIVE ((1 << 2) | (1 << 3))
+
+// Starting value for DMDFrame::rowHash() (FNV-1a offset basis)
+#define DMD_HASH_START 2166136261UL
+
+#ifdef DMD_SCAN_STATS
+
+#ifndef DMD_STATS_CLOCK
+#define DMD_STATS_CLOCK() micros()
+#endif
+
+// Interval histogram has DMD_STATS_HISTOGRAM_BINS bins, each (1<<DMD_STATS_BIN_SHIFT) clock ticks wide.
+// The last bin also counts any longer intervals.
+#define DMD_STATS_HISTOGRAM_BINS 8
+#ifndef DMD_STATS_BIN_SHIFT
+#define DMD_STATS_BIN_SHIFT 10 // ~1ms per bin when using micros()
+#endif
+
+/* Timing statistics for display scanning, all times are in DMD_STATS_CLOCK ticks.
+
+   Each BaseDMD keeps statistics for its own scanDisplay() calls, and the timer ISR
+   keeps statistics for each pass over all running displays (see BaseDMD::getTimerStats().)
+*/
+struct DMDScanStats {
+  uint32_t scans;      // Number of completed scans
+  uint32_t skipped;    // Number of scans skipped (ie the "other CS" pin was in use)
+  uint32_t min_time;   // Shortest scan
+  uint32_t max_time;   // Longest scan
+  uint32_t total_time; // Total time spent scanning
+  uint32_t first_start; // Start time of the first scan since reset
+  uint32_t last_start;  // Start time of the most recent scan
+  uint32_t last_end;    // End time of the most recent scan
+  uint32_t intervals[DMD_STATS_HISTOGRAM_BINS]; // Histogram of start-to-start times between scans
+
+  void reset();
+  void recordStart(uint32_t now);
+  void recordScan(uint32_t start, uint32_t end);
+
+  inline uint32_t avg_time() { return scans ? total_time / scans : 0; }
+  // Fraction of elapsed time spent scanning (0.0-1.0)
+  inline float cpu_fraction() {
+    uint32_t elapsed = last_end - first_start;
+    return elapsed ? (float)total_time / elapsed : 0;
+  }
+};
+
+#endif
 
 /* DMDFrame is a class encapsulating a framebuffer for the DMD, and all the graphical
    operations associated with it.
@@ -97,6 +395,14 @@ class DMD_TextBox;
 class DMDFrame
 {
   friend class DMD_TextBox;
+  friend class DMD_TextStrip;
+  friend class DMD_Ticker;
+  friend class DMD_TextLayout;
+  friend class DMD_StreamReceiver;
+  friend class DMD_Timeline;
+  friend class DMD_Transition;
+  friend class DMD_Dither;
+  friend class BaseDMD;
  public:
   DMDFrame(byte pixelsWide, byte pixelsHigh);
   DMDFrame(const DMDFrame &source);
@@ -108,7 +414,8 @@ class DMDFrame
   // Get status of a single LED
   bool getPixel(unsigned int x, unsigned int y);
 
-  // Move a region of pixels from one area to another
+  // Move a region of pixels from one area to another (the areas can overlap.)
+  // Any part of the original area that isn't covered by the new area is turned off.
   void movePixels(unsigned int from_x, unsigned int from_y,
                   unsigned int to_x, unsigned int to_y,
                   unsigned int width, unsigned int height);
@@ -119,6 +426,15 @@ class DMDFrame
   // Copy the contents of another frame back into this one at the given location
   void copyFrame(DMDFrame &from, unsigned int left, unsigned int top);
 
+  /* Load or save the whole frame as a plain row-major bitmap, as sent by most other software:
+     (width + 7) / 8 bytes per row (or 'stride' bytes if that's larger), the leftmost pixel in
+     the most significant bit of each byte, and bits set for the pixels that are on. */
+  void importLinear(const uint8_t *src, unsigned int stride = 0);
+#if defined(__AVR__) || defined(ESP8266)
+  void importLinear_P(const uint8_t *src, unsigned int stride = 0); // (from PROGMEM)
+#endif
+  void exportLinear(uint8_t *dest, unsigned int stride = 0);
+
   // Fill the screen on or off
   void fillScreen(bool on);
   inline void clearScreen() { fillScreen(false); };
@@ -133,10 +449,62 @@ class DMDFrame
   void drawFilledBox(unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2, DMDGraphicsMode mode=GRAPHICS_ON);
   void drawTestPattern(DMDTestPattern pattern);
 
+  // Neighbourhood operations, which work out 8 pixels at a time (pixels outside the frame count as off)
+  // One generation of a Life-like cellular automaton, see DMD_LIFE_BIRTH. Returns false if nothing changed.
+  inline bool stepLife(uint16_t birth = DMD_LIFE_BIRTH, uint16_t survive = DMD_LIFE_SURVIVE) {
+    return neighbourhoodStep(NEIGHBOURHOOD_LIFE, birth, survive);
+  }
+  // Turn on every pixel next to (or diagonally next to) a pixel that is on
+  inline void dilate() { neighbourhoodStep(NEIGHBOURHOOD_DILATE); }
+  // Turn off every pixel next to a pixel that is off
+  inline void erode() { neighbourhoodStep(NEIGHBOURHOOD_ERODE); }
+  // Turn off the pixels inside shapes, leaving only the on pixels that are next to an off pixel
+  inline void outline() { neighbourhoodStep(NEIGHBOURHOOD_OUTLINE); }
+
   // Text primitives
   void selectFont(const uint8_t* font);
-  const inline uint8_t *getFont(void) { return font; }
-  int drawChar(const int x, const int y, const char letter, DMDGraphicsMode mode=GRAPHICS_ON, const uint8_t *font = NULL);
+  // Select a font that isn't in PROGMEM, returns false if the font couldn't be read
+  bool selectFont(DMDFontSource &source);
+  const inline uint8_t *getFont(void) { return font; } // (NULL if a font source is selected)
+  inline DMDFontSource *getFontSource(void) { return font_source; }
+  // Header for the given font, either the cached copy for the selected font or read into 'header'
+  const FontHeader *getFontHeader(const uint8_t *font, FontHeader &header);
+  // Width of a character in the given font as drawn by drawChar(), 0 if it isn't in the font
+  static inline uint8_t fontCharWidth(const uint8_t *font, const FontHeader &header, uint16_t letter) {
+    if(letter == ' ')
+      return header.fixedWidth;
+    if(header.size == DMD_SPARSE_FONT) {
+      uint8_t width;
+      uint16_t index;
+      return findSparseGlyph(font, header, letter, width, index) ? width : 0;
+    }
+    if(letter < header.firstChar || letter >= header.firstChar + header.charCount)
+      return 0;
+    if(header.size == 0)
+      return header.fixedWidth; // fixed width font
+    return pgm_read_byte(font + sizeof(FontHeader) + letter - header.firstChar);
+  }
+  // Same, or if font is NULL the width in the selected font source
+  inline uint8_t glyphWidth(const uint8_t *font, const FontHeader &header, uint16_t letter) {
+    if(font)
+      return fontCharWidth(font, header, letter);
+    if(!font_source)
+      return 0;
+    return (letter == ' ') ? header.fixedWidth : font_source->charWidth(letter);
+  }
+  /* Draw a character with its top left corner at x,y, returns its width.
+
+     GRAPHICS_ON draws the whole character cell, the glyph's pixels on and the rest off, and
+     GRAPHICS_INVERSE the opposite. The other modes only change the pixels set in the glyph
+     and leave the rest of the cell as it was: GRAPHICS_OR turns them on, GRAPHICS_OFF and
+     GRAPHICS_NOR turn them off, and GRAPHICS_XOR swaps them. (Before drawGlyph() these
+     modes all drew the same as GRAPHICS_ON, so text drawn with them over other pixels now
+     looks different.) drawString() and the text classes pass their mode on the same way. */
+  inline int drawChar(const int x, const int y, const char letter, DMDGraphicsMode mode=GRAPHICS_ON, const uint8_t *font = NULL) {
+    return drawCodepoint(x, y, (uint8_t)letter, mode, font);
+  }
+  // Same as drawChar(), for characters beyond the first 256 in a sparse font (DMD_SPARSE_FONT)
+  int drawCodepoint(const int x, const int y, uint16_t codepoint, DMDGraphicsMode mode=GRAPHICS_ON, const uint8_t *font = NULL);
 
   void drawString(int x, int y, const char *bChars, DMDGraphicsMode mode=GRAPHICS_ON, const uint8_t *font = NULL);
   void drawString(int x, int y, const String &str, DMDGraphicsMode mode=GRAPHICS_ON, const uint8_t *font = NULL);
@@ -147,6 +515,16 @@ class DMDFrame
   }
 #endif
 
+  /* Scaled text, each pixel of the font is drawn as a scale x scale block (scale 1-32, fonts up to
+     32 pixels high.) Scale 1 is the same as drawChar()/drawString(), and the width of scaled text
+     is always stringWidth() * scale. Returns the same as drawChar() */
+  inline int drawCharScaled(const int x, const int y, const char letter, uint8_t scale, DMDGraphicsMode mode=GRAPHICS_ON, const uint8_t *font = NULL) {
+    return drawCodepointScaled(x, y, (uint8_t)letter, scale, mode, font);
+  }
+  int drawCodepointScaled(const int x, const int y, uint16_t codepoint, uint8_t scale, DMDGraphicsMode mode=GRAPHICS_ON, const uint8_t *font = NULL);
+  void drawStringScaled(int x, int y, const char *bChars, uint8_t scale, DMDGraphicsMode mode=GRAPHICS_ON, const uint8_t *font = NULL);
+  void drawStringScaled(int x, int y, const String &str, uint8_t scale, DMDGraphicsMode mode=GRAPHICS_ON, const uint8_t *font = NULL);
+
   //Find the width of a character
   int charWidth(const char letter, const uint8_t *font = NULL);
 
@@ -160,39 +538,106 @@ class DMDFrame
   unsigned int stringWidth(const char *bChars, const uint8_t *font = NULL);
   unsigned int stringWidth(const String &str, const uint8_t *font = NULL);
 
+  // Draw glyph data (FontCreator format, in PROGMEM or if in_ram is set in RAM) with its top
+  // left corner at x,y. If data is NULL, draws blank columns the full height of the glyph.
+  // The mode applies as for drawChar(): only GRAPHICS_ON and GRAPHICS_INVERSE change the
+  // pixels that are clear in the glyph (so blank columns do nothing in the other modes.)
+  void drawGlyph(int x, int y, const uint8_t *data, uint8_t glyph_width, uint8_t glyph_height, DMDGraphicsMode mode, bool in_ram = false);
+  // Same for a glyph from a packed font (DMD_PACKED_FONT), data can't be NULL
+  void drawPackedGlyph(int x, int y, const uint8_t *data, uint8_t glyph_width, uint8_t glyph_height, DMDGraphicsMode mode);
+  // Same as drawGlyph() for any kind of font, scaled up (see drawCharScaled())
+  void drawScaledGlyph(int x, int y, const uint8_t *data, uint8_t glyph_width, const FontHeader &header, uint8_t scale, DMDGraphicsMode mode, bool in_ram = false);
+
   // Scrolling & marquee support
   void scrollY(int scrollBy);
   void scrollX(int scrollBy);
   void marqueeScrollX(int scrollBy);
   void marqueeScrollY(int scrollBy);
 
+  /* In ring rows mode the bitmap rows are treated as a ring, and the frame keeps an offset
+     from each row of the frame to the bitmap row it's stored in. scrollY() and
+     marqueeScrollY() then just change the offset (and clear any new rows), rather than
+     moving all the pixel data. Turning ring rows off puts the rows back in order.
+
+     Ring rows can't be used for the frame returned by BaseDMD::beginTripleBuffering(). */
+  void setRingRows(bool enable);
+  inline bool getRingRows() { return ring_rows; }
+
   void swapBuffers(DMDFrame &other);
 
+  // Compare the pixels of two frames (frames of different sizes are never equal)
+  bool operator==(DMDFrame &other);
+  inline bool operator!=(DMDFrame &other) { return !(*this == other); }
+  /* FNV-1a hash of the pixels of the whole frame, or of row y continuing from 'hash' (so
+     rows can be hashed separately, or chained together as pixelHash() does.) Frames with
+     the same pixels have the same hash, which can be used to skip redrawing or sending a
+     frame that hasn't changed, or to spot a repeating animation. Each row's bitmap bytes
+     are hashed in order (bits set = off, with any bits past the right edge as off), so
+     hashes are the same on every kind of board. */
+  uint32_t pixelHash();
+  uint32_t rowHash(unsigned int y, uint32_t hash = DMD_HASH_START);
+  // Number of pixels that are on
+  unsigned int countPixelsOn();
+
   const byte width; // in pixels
   const byte height; // in pixels
  protected:
   volatile uint8_t *bitmap;
   byte row_width_bytes; // width in bitmap, bit-per-pixel rounded up to nearest byte
   byte height_in_panels; // in panels
+  bool ring_rows;
+  byte row_offset; // ring rows mode, bitmap row holding row 0 of the frame
 
   uint8_t *font;
+  DMDFontSource *font_source; // selected font if it isn't in PROGMEM (font is NULL)
+  FontHeader font_header; // copy of the selected font's header
+  uint16_t *glyph_offsets; // data offset of every DMD_GLYPH_OFFSET_STRIDE'th glyph in the selected font
+  // Find width and data offset of a glyph, returns false if it's not in the font
+  bool findGlyph(const uint8_t *font, const FontHeader *header, uint16_t letter, uint8_t &width, uint16_t &index);
+  // Same for a sparse font (DMD_SPARSE_FONT)
+  static bool findSparseGlyph(const uint8_t *font, const FontHeader &header, uint16_t letter, uint8_t &width, uint16_t &index);
+
+  // Pixels of one column of a packed font glyph, bit 0 is the top row of the glyph
+  static uint32_t packedColumn(const uint8_t *data, uint8_t column);
+
+  enum NeighbourhoodOp { NEIGHBOURHOOD_LIFE, NEIGHBOURHOOD_DILATE, NEIGHBOURHOOD_ERODE, NEIGHBOURHOOD_OUTLINE };
+  // Replace every pixel with the result of 'op' on the pixels around it, returns true if any changed
+  bool neighbourhoodStep(uint8_t op, uint16_t birth = 0, uint16_t survive = 0);
+
+  // Copy 'count' pixels from bit 'src_x' of the row at 'src' (MSB first, same layout as the bitmap)
+  // to bit 'dest_x' of the row at 'dest'. The source and destination must not overlap.
+  static void copyRowBits(volatile uint8_t *dest, unsigned int dest_x, const uint8_t *src, unsigned long src_x, unsigned int count);
+  // Move 'count' pixels from bit 'src_x' to bit 'dest_x' within the same row, which may overlap
+  static void moveRowBits(volatile uint8_t *row, unsigned int dest_x, unsigned int src_x, unsigned int count);
+  // Turn 'count' pixels starting at bit 'dest_x' of the row at 'dest' on or off
+  static void fillRowBits(volatile uint8_t *dest, unsigned int dest_x, unsigned int count, bool on);
 
   inline size_t bitmap_bytes() {
-    // total bytes in the bitmap
-    return row_width_bytes * height;
+    // total bytes in the bitmap (every row of panels past the first is a full panel high)
+    return unified_width_bytes() * (height_in_panels > 1 ? PANEL_HEIGHT : height);
   }
   inline size_t unified_width_bytes() {
     // controller sees all panels as end-to-end, so bitmap arranges it that way
     return row_width_bytes * height_in_panels;
   }
-  inline int pixelToBitmapIndex(unsigned int x, unsigned int y) {
-    // Panels seen as stretched out in a row for purposes of finding index
-    uint8_t panel = (x/PANEL_WIDTH) + ((width/PANEL_WIDTH) * (y/PANEL_HEIGHT));
-    x = (x % PANEL_WIDTH)  + (panel * PANEL_WIDTH);
-    y = y % PANEL_HEIGHT;
-    int res = x / 8 + (y * unified_width_bytes());
+  inline int rowToBitmapIndex(unsigned int y) {
+    // Row offset is only non-zero in ring rows mode
+    y += row_offset;
+    if(y >= height)
+      y -= height;
+    return storedRowToBitmapIndex(y);
+  }
+  void rotateRows(int scrollBy);
+  inline int storedRowToBitmapIndex(unsigned int y) {
+    // Panels seen as stretched out in a row for purposes of finding index,
+    // with each row of panels following on from the row of panels above it.
+    // The bytes for the rest of the row follow on from the returned index.
+    int res = (y / PANEL_HEIGHT) * row_width_bytes + (y % PANEL_HEIGHT) * unified_width_bytes();
     return res;
   }
+  inline int pixelToBitmapIndex(unsigned int x, unsigned int y) {
+    return x / 8 + rowToBitmapIndex(y);
+  }
   inline uint8_t pixelToBitmask(unsigned int x) {
     int res = pgm_read_byte(DMD_Pixel_Lut + (x & 0x07));
     return res;
@@ -210,7 +655,24 @@ protected:
   BaseDMD(byte panelsWide, byte panelsHigh, byte pin_noe, byte pin_a, byte pin_b, byte pin_sck);
 
   virtual void writeSPIData(volatile uint8_t *rows[4], const int rowsize) = 0;
+
+  // Send out the interleaved rows for the current scan_row, via writeSPIData()
+  void writeScanRows();
+  // Same for the part of the canvas inside the viewport
+  void writeCanvasRows();
+
+  /* Pin outputs used by scanDisplay(). In a host build (DMD2_HOST) these are virtual so
+     VirtualDMD can capture the scan sequence, on a board they are direct pin writes. */
+#ifdef DMD2_HOST
+  virtual void writeScanPin(byte pin, byte value);
+  virtual void writeScanBrightness(byte pin, byte level);
+#else
+  inline void writeScanPin(byte pin, byte value) { digitalWrite(pin, value); }
+  inline void writeScanBrightness(byte pin, byte level) { analogWrite(pin, level); }
+#endif
 public:
+  virtual ~BaseDMD();
+
   /* Refresh the display by manually scanning out current array of
      pixels. Call often, or use begin()/end() to automatically scan
      the display (see below.)
@@ -228,6 +690,73 @@ public:
   virtual void beginNoTimer();
 
   inline void setBrightness(byte level) { this->brightness = level; };
+
+  /* Show the contents of another frame (the same size as the display) by swapping buffers
+     with it, at the start of the next full scan of the display. This means a refresh never
+     shows half of the old frame and half of the new one, as can happen with swapBuffers().
+
+     After the swap the frame holds the previously displayed buffer, to draw the next frame into.
+
+     present() waits for the swap to happen, so the display must be scanning (ie begin() was
+     called, or scanDisplay() is being called from an interrupt.)
+
+     presentAsync() queues the swap and returns immediately, so drawing can carry on while the
+     rest of the current frame scans out. Don't draw into the frame until the swap has happened:
+     poll presentPending(), or pass a callback (called from the timer ISR after the swap.)
+     Returns false if the frame is the wrong size, or a swap is already pending.
+  */
+  bool present(DMDFrame &frame);
+  bool presentAsync(DMDFrame &frame, void (*callback)(BaseDMD &dmd) = NULL);
+  inline bool presentPending() { return present_pending; }
+
+  /* Triple buffered rendering, for when the time taken to draw each frame varies a lot.
+
+     beginTripleBuffering() allocates two more buffers and returns a frame to draw into
+     (or NULL if there isn't enough memory.) commitFrame() hands the finished frame over
+     to be shown from the start of the next scan, and gives the frame a free buffer to
+     draw the next one into. It never waits for the display: if more than one frame is
+     committed between scans, only the newest is shown and the others are dropped.
+
+     The new buffer contents are stale unless keep_contents is set, in which case the
+     committed frame is copied into it (for drawing incremental changes.)
+
+     Don't draw into the display itself, or use present() or swapBuffers() on it, while
+     triple buffering. endTripleBuffering() frees the extra buffers and the frame.
+  */
+  DMDFrame *beginTripleBuffering();
+  void commitFrame(bool keep_contents = false);
+  void endTripleBuffering();
+
+  /* Virtual canvas, for showing part of a frame bigger than the display.
+
+     setCanvas() makes the display scan out from 'canvas' instead of its own bitmap, and
+     setViewport() picks which part of the canvas is shown (x,y is the canvas pixel shown
+     at the top left of the display.) Moving the viewport doesn't touch the pixel data, the
+     scan just reads from a different place. Viewport positions that aren't a multiple of 8
+     pixels across are shifted into place as each row is sent, which makes the scan a bit
+     slower.
+
+     The canvas must be at least as big as the display. Changes take effect from the start
+     of the next full scan of the display (so never show a mix of two positions), until then
+     canvasPending() returns true. setCanvas(NULL) goes back to showing the display's own
+     bitmap, don't free the old canvas while the change is still pending.
+  */
+  bool setCanvas(DMDFrame *canvas);
+  inline DMDFrame *getCanvas() { return next_canvas; }
+  void setViewport(unsigned int x, unsigned int y);
+  inline unsigned int getViewportX() { return next_view_x; }
+  inline unsigned int getViewportY() { return next_view_y; }
+  inline bool canvasPending() { return canvas_pending; }
+
+#ifdef DMD_SCAN_STATS
+  /* Take a consistent copy of the scan statistics for this display, or reset them */
+  void getScanStats(DMDScanStats &stats);
+  void resetScanStats();
+
+  /* Statistics for the timer ISR as a whole (all running displays, see begin()) */
+  static void getTimerStats(DMDScanStats &stats);
+  static void resetTimerStats();
+#endif
 protected:
   volatile byte scan_row;
   byte pin_noe;
@@ -240,6 +769,32 @@ protected:
 
   uint8_t brightness;
 
+  // Frame waiting to be swapped in by present()
+  DMDFrame *volatile present_frame;
+  void (*volatile present_callback)(BaseDMD &dmd);
+  volatile bool present_pending;
+
+  // Triple buffering state. triple_state holds the index of the buffer which is neither
+  // being shown (triple_front, ISR owned) or drawn into (triple_back), plus a "fresh" flag.
+  DMDFrame *triple_frame;
+  volatile uint8_t *triple_buffers[3];
+  volatile uint8_t triple_state;
+  uint8_t triple_front;
+  uint8_t triple_back;
+
+  // Virtual canvas state. The next_ values are applied by the scan at the start of a frame.
+  DMDFrame *canvas;
+  byte view_x;
+  byte view_y;
+  DMDFrame *volatile next_canvas;
+  volatile byte next_view_x;
+  volatile byte next_view_y;
+  volatile bool canvas_pending;
+  uint8_t *shift_buffer; // 4 rows of shifted canvas data, for viewports not on a byte boundary
+
+#ifdef DMD_SCAN_STATS
+  DMDScanStats scan_stats;
+#endif
 };
 
 class SPIDMD : public BaseDMD
@@ -281,10 +836,70 @@ private:
 };
 #endif
 
+#ifdef DMD2_HOST
+/* VirtualDMD is an emulated chain of DMD panels, for testing and debugging without hardware.
+
+   The unmodified scanDisplay() sequence drives a model of the panels' shift registers,
+   latches, row select (A/B) and output enable lines instead of any real pins, so the image
+   reconstructed here is what the physical panels would show (including the 4-row interleave
+   and daisy-chain order.) It also measures how long each row is lit for.
+
+   It is only built for the host (see extras/host), where the scan pin outputs are virtual.
+*/
+class VirtualDMD : public BaseDMD
+{
+public:
+  VirtualDMD(byte panelsWide, byte panelsHigh);
+  ~VirtualDMD();
+
+  void beginNoTimer();
+
+  // Number of panels in the chain. Chain position 0 is nearest the controller.
+  inline byte chainLength() { return chain_length; }
+
+  // Pixel being shown by a panel, by position in the chain and x/y within that panel
+  bool getPanelPixel(byte chain_pos, unsigned int x, unsigned int y);
+
+  // Pixel being shown at a location on the display (ie panels arranged as for drawing)
+  bool getShownPixel(unsigned int x, unsigned int y);
+
+  // Write the image being shown as a plain (ASCII) PBM file, or as ASCII art
+  void writePBM(Print &out);
+  void writeASCII(Print &out);
+
+  // Total time (micros) each panel row (0-15) has been lit for, and the fraction of total time
+  uint32_t rowOnTime(byte row);
+  float rowDuty(byte row);
+  void resetTiming();
+
+protected:
+  void writeSPIData(volatile uint8_t *rows[4], const int rowsize);
+  void writeScanPin(byte pin, byte value);
+  void writeScanBrightness(byte pin, byte level);
+
+private:
+  void updateOutput(byte oe_level);
+
+  byte chain_length;
+  uint8_t *shift_reg; // bytes as shifted into the chain, circular buffer
+  uint16_t shift_head;
+  uint8_t *latched; // latched shift register contents, oldest byte first
+  uint8_t *shown; // panel pixels (bit set = lit) for each chain position, 32x16 each
+  byte select; // A/B row select lines
+  byte oe_level; // output enable level, 0-255
+  uint32_t last_change;
+  uint32_t start_time;
+  uint32_t on_time[4]; // per row select value, weighted by output enable level
+};
+#endif
+
 class DMD_TextBox : public Print {
 public:
   DMD_TextBox(DMDFrame &dmd, int left = 0, int top = 0, int width = 0, int height = 0);
   virtual size_t write(uint8_t);
+  // Write a run of characters, scrolling the box at most a couple of times for the whole run
+  virtual size_t write(const uint8_t *buffer, size_t size);
+  using Print::write;
   void clear();
   void reset();
   void invertDisplay() { inverted = !inverted; }
@@ -301,15 +916,541 @@ private:
   int16_t cur_x;
   int16_t cur_y;
   bool pending_newline;
+  DMD_UTF8Decoder decoder; // sparse fonts, part of a character from the last write
+
+  int wrap(uint8_t char_width, uint8_t row_height);
+  bool drawsInside(uint16_t character, uint8_t char_width, uint8_t row_height);
+  void drawAt(uint16_t character, int x, int y, uint8_t row_height);
+  void scrollBox(uint32_t scrollBy, bool vertical);
 };
 
-// Six byte header at beginning of FontCreator font structure, stored in PROGMEM
-struct FontHeader {
-  uint16_t size;
-  uint8_t fixedWidth;
-  uint8_t height;
-  uint8_t firstChar;
-  uint8_t charCount;
+/* DMD_TextStrip renders a string into its own bit-per-pixel strip, which can be any
+   number of pixels long, and scrolls a window of the strip across a region of a frame.
+   Each scroll step costs the same however long the message is, so long marquees don't
+   need a frame wider than the real display.
+
+   In lazy mode only a chunk of the strip a little wider than the region is rendered
+   at a time, and the next chunk is rendered once the window moves past it. The text
+   isn't copied in lazy mode, so it needs to stay valid while the strip is in use.
+*/
+class DMD_TextStrip {
+public:
+  DMD_TextStrip(DMDFrame &dmd, int left = 0, int top = 0, int width = 0, int height = 0);
+  ~DMD_TextStrip();
+
+  // Render text using the frame's currently selected font. Returns false if there wasn't enough RAM.
+  bool setText(const char *text, bool lazy = false);
+#if defined(__AVR__) || defined(ESP8266)
+  bool setText_P(const char *flashStr, bool lazy = false);
+  inline bool setText(const __FlashStringHelper *flashStr, bool lazy = false) {
+    return setText_P((const char*)flashStr, lazy);
+  }
+#else
+  // Flash strings can be read like any other string
+  inline bool setText(const __FlashStringHelper *flashStr, bool lazy = false) {
+    return setText((const char*)flashStr, lazy);
+  }
+#endif
+
+  // Move the window along the strip by scrollBy pixels and redraw it. The text scrolls
+  // in from the right edge of the region and starts again once it has scrolled off the left.
+  void scroll(int scrollBy = 1);
+  // Set the strip column shown at the left edge of the region (negative is blank space before the text)
+  void setOffset(long offset) { this->offset = offset; }
+  long getOffset() { return offset; }
+  // Draw the window at the current offset into the frame
+  void draw();
+
+  unsigned long getTextWidth() { return text_width; }
+private:
+  DMD_TextStrip(const DMD_TextStrip &); // not copyable
+
+  DMDFrame &dmd;
+  int left;
+  int top;
+  int width;
+  int height;
+
+  const char *text;
+  bool text_flash;
+  const uint8_t *font;
+  FontHeader header;
+  unsigned long text_width;
+  long offset;
+
+  uint8_t *strip; // rendered columns, rows of strip_stride bytes in the bitmap layout
+  uint16_t strip_stride;
+  bool lazy;
+  long chunk_x; // strip column of the first column held in 'strip'
+  uint16_t chunk_width; // columns held in 'strip'
+  uint16_t chunk_char; // lazy mode, first character overlapping the rendered chunk...
+  long chunk_char_x; // ...and the strip column it starts at
+
+  bool begin(const char *text, bool flash, bool lazy);
+  inline char charAt(uint16_t idx) { return text_flash ? pgm_read_byte(text + idx) : text[idx]; }
+  uint8_t glyphWidth(uint16_t letter, uint16_t &index);
+  void renderChunk(long from_x);
+};
+
+/* DMD_Ticker scrolls an endless stream of text right to left across a region of a frame.
+
+   Text written to the ticker (it implements the Arduino Print interface) goes into a small
+   queue, and each column of each character is only rendered from the font as it scrolls
+   onto the display, into a ring of columns the width of the region. Memory use depends on
+   the size of the region, not on the amount of text, and each column scrolled renders just
+   that one column. Several tickers can share a frame, each with its own region and speed.
+*/
+#ifndef DMD_TICKER_QUEUE
+#define DMD_TICKER_QUEUE 32 // characters waiting to be scrolled on, per ticker
+#endif
+
+class DMD_Ticker : public Print {
+public:
+  DMD_Ticker(DMDFrame &dmd, int left = 0, int top = 0, int width = 0, int height = 0);
+  ~DMD_Ticker();
+
+  // Queue a character, returns 0 if the queue is full
+  virtual size_t write(uint8_t);
+  // Number of characters that can be written before the queue is full
+  int availableForWrite() { return DMD_TICKER_QUEUE - queue_len; }
+  // True once every queued character has scrolled onto the display
+  bool idle() { return queue_len == 0 && glyph_col > glyph_width; }
+
+  // Scroll left by 'columns' pixels, rendering the new columns, and redraw the region
+  void step(unsigned int columns = 1);
+  // Speed for update(), in pixels per second (0 = stopped)
+  void setSpeed(unsigned int pixelsPerSecond) { speed = pixelsPerSecond; }
+  // Call often, scrolls by however many pixels are due at the current speed. Returns true if it scrolled.
+  bool update();
+  // Blank the region and throw away any queued text
+  void clear();
+private:
+  DMD_Ticker(const DMD_Ticker &); // not copyable
+
+  DMDFrame &dmd;
+  int left;
+  int top;
+  int width;
+  int height;
+
+  char queue[DMD_TICKER_QUEUE];
+  uint8_t queue_head;
+  uint8_t queue_len;
+  DMD_UTF8Decoder decoder; // sparse fonts, characters can be several bytes of the queue
+
+  uint8_t *ring; // one row of 'width' columns per line of the region, bitmap layout
+  uint16_t ring_stride;
+  uint16_t ring_head; // column of the ring shown at the left edge of the region
+  uint8_t hidden_rows; // glyph rows above the top of the frame, not in the ring
+
+  // Character currently scrolling on
+  FontHeader header;
+  const uint8_t *glyph_data; // NULL for blank columns
+  uint8_t glyph_width;
+  uint8_t glyph_col; // next column to render, glyph_width is the blank column after the glyph
+
+  unsigned int speed;
+  unsigned long last_update;
+  unsigned int carry; // milliseconds x pixels/second towards the next column
+
+  bool begin();
+  void nextGlyph();
+  void renderColumn(uint16_t col);
+};
+
+// One line of text laid out by DMD_TextLayout, characters [start, end) of the text drawn with
+// their top left corner at x,y (relative to the box)
+struct DMDTextRun {
+  uint16_t start;
+  uint16_t end;
+  int16_t x;
+  int16_t y;
+};
+
+#ifndef DMD_LAYOUT_MAX_LINES
+#define DMD_LAYOUT_MAX_LINES 8
+#endif
+
+/* DMD_TextLayout word wraps and aligns a string into a box on a frame.
+
+   layout() measures the text and breaks it into lines in a single pass, producing a run for
+   each line which draw() then renders. Calling layout() again with the same text, font and
+   alignment reuses the previous runs, so redrawing text that hasn't changed (clocks,
+   dashboards, etc.) doesn't measure it again. A copy of the text (on the heap) is kept to
+   compare against, so text changed in place in the same buffer is laid out again.
+
+   draw() draws from the caller's text, so it needs to stay valid until it's been drawn.
+*/
+class DMD_TextLayout {
+public:
+  DMD_TextLayout(DMDFrame &dmd, int left = 0, int top = 0, int width = 0, int height = 0);
+  ~DMD_TextLayout();
+
+  void setAlignment(DMDTextAlign align) { this->align = align; }
+  // Lay out text in the box using the given font (default is the frame's selected font).
+  // Returns the number of lines, lines that don't fit in the box are left out.
+  uint8_t layout(const char *text, const uint8_t *font = NULL);
+  // Draw the laid out text. For GRAPHICS_ON and GRAPHICS_INVERSE the box is cleared first if clearBox is set
+  void draw(DMDGraphicsMode mode = GRAPHICS_ON, bool clearBox = true);
+
+  // Lay out and draw in one step
+  inline void drawText(const char *text, DMDGraphicsMode mode = GRAPHICS_ON, const uint8_t *font = NULL) {
+    layout(text, font);
+    draw(mode);
+  }
+  inline void drawText(const String &str, DMDGraphicsMode mode = GRAPHICS_ON, const uint8_t *font = NULL) {
+    drawText(str.c_str(), mode, font);
+  }
+
+  uint8_t getLineCount() { return line_count; }
+  const DMDTextRun &getLine(uint8_t line) { return runs[line]; }
+private:
+  DMDFrame &dmd;
+  int left;
+  int top;
+  int width;
+  int height;
+  DMDTextAlign align;
+
+  const char *text;
+  const uint8_t *font;
+  FontHeader header;
+  DMDTextRun runs[DMD_LAYOUT_MAX_LINES];
+  uint8_t line_count;
+
+  // What the current runs were laid out from
+  char *laid_out_text; // copy of the text, NULL if there isn't one
+  uint16_t laid_out_size; // bytes allocated for laid_out_text
+  DMDTextAlign laid_out_align;
+
+  DMD_TextLayout(const DMD_TextLayout &); // not copyable
+  bool addRun(uint16_t start, uint16_t end, unsigned int line_width);
+};
+
+/* DMD_StreamReceiver decodes frames sent over a serial port (or any Stream) into a back
+   buffer, and shows each one when it's complete. Bytes are decoded as they arrive, without
+   holding a whole packet in RAM. extras/dmdstream.py sends frames from a PC.
+
+   Each packet is:
+
+     0xD2 0x4D              sync
+     type                   one of the DMD_STREAM_... types below
+     length                 2 bytes, little endian, number of payload bytes
+     payload
+     CRC                    2 bytes, little endian, CRC16-CCITT (polynomial 0x1021, starting
+                            from 0xFFFF) of the type, length and payload
+
+   Frames are in the linear format (see DMDFrame::importLinear()), and the delta packets are
+   XORed with the previous frame so unchanged pixels are 0. Packets with a bad CRC or payload
+   are dropped and counted (getErrorCount()), and the previous frame stays on the display.
+   After a dropped packet the sender's idea of the previous frame is wrong, so it should send
+   a full frame every so often (or whenever the error count it's told about goes up.)
+   A length longer than the payload could be (a full frame, plus a row number per row for
+   delta rows or a count per 128 bytes for RLE) is taken as a false sync and skipped.
+
+   With a BaseDMD, each frame is shown with presentAsync(). Until that swap happens (at the
+   start of the next scan) the next packet isn't decoded past its type, and the bytes wait in
+   the serial port's receive buffer.
+*/
+#define DMD_STREAM_SYNC1 0xD2
+#define DMD_STREAM_SYNC2 0x4D
+#define DMD_STREAM_FULL 'F' // every row of the frame
+#define DMD_STREAM_DELTA_ROWS 'D' // for each changed row in order, the row number then the XORed row
+#define DMD_STREAM_DELTA_RLE 'R' // the XORed frame in runs: a byte n < 0x80 then n+1 bytes as they are,
+                                 // or n >= 0x80 then one byte repeated n-0x7E times. Rows past the
+                                 // end of the runs are unchanged.
+
+class DMD_StreamReceiver : public Print {
+public:
+  // Decode frames into 'back' and show them on the display
+  DMD_StreamReceiver(BaseDMD &dmd, DMDFrame &back);
+  // Decode frames into 'back' and swap them into 'front' with swapBuffers()
+  DMD_StreamReceiver(DMDFrame &front, DMDFrame &back);
+
+  // Decode one byte. Returns 0 (and doesn't use the byte) while the last frame is waiting to be shown.
+  virtual size_t write(uint8_t);
+  using Print::write;
+  // Decode the bytes waiting in a stream, returns true if a frame was completed
+  bool poll(Stream &stream);
+  // Drop any partly received packet and wait for the next one
+  void reset();
+
+  uint32_t getFrameCount() { return frame_count; }
+  uint32_t getErrorCount() { return error_count; }
+
+  // Add a byte to a CRC16-CCITT, as used for the packets
+  static inline uint16_t crcUpdate(uint16_t crc, uint8_t value) {
+    uint8_t x = (crc >> 8) ^ value;
+    x ^= x >> 4;
+    return (crc << 8) ^ ((uint16_t)x << 12) ^ ((uint16_t)x << 5) ^ x;
+  }
+private:
+  DMD_StreamReceiver(const DMD_StreamReceiver &); // not copyable
+
+  BaseDMD *dmd; // NULL if frames are swapped in with swapBuffers()
+  DMDFrame &front;
+  DMDFrame &back;
+
+  uint8_t state;
+  uint8_t type;
+  uint16_t length;
+  uint16_t received; // payload bytes so far
+  uint16_t crc;
+  uint8_t crc_low;
+  bool bad; // something in the payload was wrong, drop the packet
+
+  // Where the next byte of pixels goes
+  uint8_t row;
+  uint8_t col;
+  volatile uint8_t *back_row;
+  const volatile uint8_t *front_row;
+  uint8_t padding; // bits past the right edge of the frame in the last byte of each row
+
+  bool expect_row; // delta rows, the next byte is a row number
+  uint8_t run; // RLE, bytes left in the current run (0 = next byte starts a run)
+  bool repeat; // RLE, the current run is one byte repeated
+
+  uint32_t frame_count;
+  uint32_t error_count;
+
+  void init();
+  bool waiting();
+  void startRow(uint8_t y);
+  void putPixels(uint8_t value, bool delta);
+  void finishRows(uint8_t end_row);
+  void payloadByte(uint8_t value);
+  void finishPacket();
+  uint16_t maxLength();
+};
+
+/* DMD_Timeline runs animations without delay(). Each track is stepped every 'period'
+   milliseconds, by tick() - call it often (eg every time round loop()) with millis().
+
+   Each step is due a whole number of periods after the track started, whenever the
+   last one actually ran, so tracks don't drift. If tick() is late and several steps
+   are due at once they are done together (a scroll track moves 3 pixels in one go, say),
+   and getLateness() says how late the update was. Function and ticker tracks only catch
+   up to DMD_TIMELINE_MAX_STEPS steps at a time and skip the rest (see getSkippedSteps()),
+   without moving when the later steps are due.
+
+   All the tracks that are due in one tick() update the frame together. Pass the display as
+   well as the frame returned by its beginTripleBuffering() to show each tick's updates as
+   one frame, with commitFrame(true), so the display never shows some updates without the
+   others. Otherwise the tracks draw straight onto the frame.
+
+   The first tick() after a track is added just draws it (eg the first of a sequence of
+   frames), and its first step is one period later. A period of 0 pauses a track.
+*/
+#ifndef DMD_TIMELINE_TRACKS
+#define DMD_TIMELINE_TRACKS 6
+#endif
+
+#ifndef DMD_TIMELINE_MAX_STEPS
+#define DMD_TIMELINE_MAX_STEPS 64
+#endif
+
+/* Steps a track added with DMD_Timeline::addFunction(). 'steps' is the number of periods
+   since the last call (more than one if tick() was late, 0 for the first call.) */
+typedef void (*DMDTrackFunction)(DMDFrame &frame, void *context, unsigned int steps);
+
+class DMD_Timeline {
+public:
+  DMD_Timeline(DMDFrame &frame, BaseDMD *dmd = NULL);
+
+  /* Each of these adds a track and returns its number, or -1 if there are already
+     DMD_TIMELINE_TRACKS tracks. */
+  // Call 'function' every period
+  int addFunction(unsigned long period, DMDTrackFunction function, void *context = NULL);
+  // Scroll part of the frame by dx,dy pixels every period (width/height 0 = to the edge of the
+  // frame.) With wrap, pixels that scroll off one side of the area come back on the other.
+  int addScroll(unsigned long period, int dx, int dy, bool wrap = false,
+                unsigned int left = 0, unsigned int top = 0, unsigned int width = 0, unsigned int height = 0);
+  // Show 'element' at left,top, then turn the area it covers off, and so on
+  int addBlink(unsigned long period, DMDFrame &element, unsigned int left = 0, unsigned int top = 0);
+  // Show each of 'count' frames at left,top in turn, looping
+  int addFrames(unsigned long period, DMDFrame **frames, uint8_t count, unsigned int left = 0, unsigned int top = 0);
+  // Scroll a ticker on by 'columns' pixels every period (the ticker must draw into the timeline's frame)
+  int addTicker(unsigned long period, DMD_Ticker &ticker, unsigned int columns = 1);
+
+  void remove(int track);
+  // Change how often a track is stepped, from its next step on (0 pauses it)
+  void setPeriod(int track, unsigned long period);
+
+  // Do every step that is due at time 'now' (in milliseconds.) Returns true if anything was drawn.
+  bool tick(unsigned long now);
+
+  // How many milliseconds after it was due the track's last update ran, and the most it has been
+  // (both stop at 65535.) Steps skipped by function and ticker tracks, see DMD_TIMELINE_MAX_STEPS.
+  uint16_t getLateness(int track);
+  uint16_t getMaxLateness(int track);
+  uint16_t getSkippedSteps(int track);
+private:
+  DMD_Timeline(const DMD_Timeline &); // not copyable
+
+  enum TrackKind { TRACK_NONE, TRACK_FUNCTION, TRACK_SCROLL, TRACK_BLINK, TRACK_FRAMES, TRACK_TICKER };
+
+  struct Track {
+    uint8_t kind;
+    bool started; // false until the first tick() after it's added (or unpaused)
+    unsigned long period;
+    unsigned long due; // time of the next step
+    uint16_t lateness;
+    uint16_t max_lateness;
+    uint16_t skipped;
+    DMDTrackFunction function;
+    void *target; // function context, blink element, array of frames or ticker
+    int8_t dx; // scroll, pixels per step
+    int8_t dy;
+    uint8_t left; // area covered
+    uint8_t top;
+    uint8_t width;
+    uint8_t height;
+    uint8_t count; // frames, number of frames (scroll: 1 to wrap, ticker: columns per step)
+    uint8_t position; // frames, the one shown (blink: 1 if shown)
+  };
+
+  DMDFrame &frame;
+  BaseDMD *dmd; // commit each tick's updates to this, if triple buffering
+  Track tracks[DMD_TIMELINE_TRACKS];
+
+  Track *track(int track);
+  int add(uint8_t kind, unsigned long period, void *target);
+  bool step(Track &t, unsigned long steps);
+  void scroll(Track &t, unsigned long steps);
+};
+
+/* Transition effects, from one frame to another over a number of steps. The direction is the
+   way the pixels move: TRANSITION_WIPE_RIGHT reveals the new frame from the left edge, and
+   TRANSITION_PUSH_LEFT moves both frames left with the new one coming on from the right. */
+enum DMDTransitionEffect {
+  TRANSITION_CUT, // straight to the new frame
+  TRANSITION_WIPE_LEFT, // the edge of the new frame moves across the old one
+  TRANSITION_WIPE_RIGHT,
+  TRANSITION_WIPE_UP,
+  TRANSITION_WIPE_DOWN,
+  TRANSITION_DISSOLVE, // pixels change to the new frame in a random-looking order
+  TRANSITION_PUSH_LEFT, // the new frame pushes the old one off
+  TRANSITION_PUSH_RIGHT,
+  TRANSITION_PUSH_UP,
+  TRANSITION_PUSH_DOWN,
+  TRANSITION_SLIDE_LEFT, // the new frame slides on over the old one
+  TRANSITION_SLIDE_RIGHT,
+  TRANSITION_SLIDE_UP,
+  TRANSITION_SLIDE_DOWN,
+};
+
+/* DMD_Transition draws each step of a transition from one frame to another into a third,
+   eg the display or a back buffer to present(). All three must be the same size, and stay
+   unchanged (apart from 'dest') until it's finished.
+
+   Every step is drawn from the two frames whole, a byte or a run of pixels at a time, so
+   each one takes about the same time as copying a frame and it doesn't matter what 'dest'
+   held before. The dissolve reveals pixels in the order of a 9 bit LFSR over each block of
+   32x16 pixels (offset a bit from one block to the next), kept as a 64 byte mask.
+
+   To run it from a DMD_Timeline, with 'dest' as the timeline's frame:
+
+     timeline.addFunction(period, DMD_Transition::timelineStep, &transition);
+*/
+class DMD_Transition {
+public:
+  DMD_Transition(DMDFrame &dest, DMDFrame &from, DMDFrame &to, DMDTransitionEffect effect, uint16_t steps);
+
+  // Draw the step 'steps' on from the last one drawn. Returns true if there are more to come.
+  bool step(uint16_t steps = 1);
+  // Draw step 'position', from 0 (the 'from' frame) to getSteps() (the 'to' frame)
+  void render(uint16_t position);
+  inline bool done() { return position >= steps; }
+  inline uint16_t getPosition() { return position; }
+  inline uint16_t getSteps() { return steps; }
+
+  // DMDTrackFunction for DMD_Timeline::addFunction(), 'transition' is the DMD_Transition
+  static void timelineStep(DMDFrame &frame, void *transition, unsigned int steps);
+private:
+  DMD_Transition(const DMD_Transition &); // not copyable
+
+  DMDFrame &dest;
+  DMDFrame &from;
+  DMDFrame &to;
+  uint8_t effect;
+  uint16_t steps;
+  uint16_t position;
+
+  // Dissolve, bits set for the pixels of a 32x16 block showing the new frame so far
+  uint8_t mask[16][4];
+  uint16_t mask_count; // number of bits set
+  uint16_t lfsr;
+
+  void updateMask(uint16_t count);
+  void renderWipe(unsigned int amount, bool across, bool reverse);
+  void renderDissolve();
+  void renderPush(unsigned int amount, bool across, bool reverse, bool push);
+};
+
+// How DMD_Dither turns shades of grey into pixels that are on or off
+enum DMDDitherMethod {
+  DITHER_THRESHOLD, // on if at least half brightness
+  DITHER_BAYER, // ordered dither, with an 8x8 Bayer matrix (64 levels, a regular pattern)
+  DITHER_FLOYD_STEINBERG, // error diffusion (smoother, but needs a row of error values)
+};
+
+// Format of the pixels given to DMD_Dither
+enum DMDGreyFormat {
+  GREY_8BIT, // one pixel per byte, 0 = off, 255 = full brightness
+  GREY_4BIT, // two pixels per byte, the left one in the high nibble. If the width is odd,
+             // each row ends with a byte whose low nibble is ignored.
+};
+
+/* DMD_Dither draws a greyscale image into an area of a frame, a pixel at a time, as it's
+   read from wherever it's coming from (print or write bytes from flash, an SD card file,
+   Serial...) Pixels go left to right, then top to bottom, and each is dithered and written
+   straight into the frame. Once the area is full, write() returns 0.
+
+   Floyd-Steinberg dithering spreads errors onto the next row, kept in a buffer of 2 bytes
+   per pixel across (allocated the first time it's needed.) Nothing else is buffered.
+*/
+class DMD_Dither : public Print {
+public:
+  DMD_Dither(DMDFrame &frame, DMDDitherMethod method = DITHER_BAYER, DMDGreyFormat format = GREY_8BIT,
+             int left = 0, int top = 0, int width = 0, int height = 0);
+  ~DMD_Dither();
+
+  // Dither the next byte of pixels. Returns 0 if the area is already full, or there's no memory for
+  // the error buffer.
+  virtual size_t write(uint8_t);
+  using Print::write;
+  // Dither a whole row of pixels at once
+  void writeRow(const uint8_t *row);
+#if defined(__AVR__) || defined(ESP8266)
+  void writeRow_P(const uint8_t *row); // (from PROGMEM)
+#endif
+  // True once every row of the area has been drawn
+  inline bool done() { return y >= height; }
+  // Start again from the top left of the area
+  void restart();
+private:
+  DMD_Dither(const DMD_Dither &); // not copyable
+
+  DMDFrame &frame;
+  uint8_t method;
+  uint8_t format;
+  int left;
+  int top;
+  int width;
+  int height;
+
+  int x; // position of the next pixel in the area
+  int y;
+  uint8_t out; // pixels of the current run, bits set = off (as in the bitmap)
+  uint8_t out_count;
+
+  int16_t *errors; // Floyd-Steinberg, see DMD2_Dither.cpp
+  int16_t error_right;
+  int16_t error_below_right;
+
+  bool begin();
+  void pixel(uint8_t value);
+  void flush();
 };
 
 #endif
@@ -0,0 +1,269 @@
+/*
+ DMD cached font implementation
+
+ Fonts read from storage (ie an SD card, see DMD2_SDFont.h) a glyph at a
+ time, keeping the most recently used glyphs in a small cache in RAM.
+
+ Copyright (C) 2014 Freetronics, Inc. (info <at> freetronics <dot> com)
+
+---
+
+ This program is free software: you can redistribute it and/or modify it under the terms
+ of the version 3 GNU General Public License as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program.
+ If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "DMD2.h"
+
+// Sparse font tables, same layout as DMD2_SparseFont.cpp
+const uint8_t RANGE_BYTES = 5;
+const uint8_t ENTRY_BYTES = 3;
+
+const uint16_t EMPTY_SLOT = 0xFFFF; // not a character
+
+static inline uint16_t readWord(const uint8_t *p)
+{
+  return p[0] | (p[1] << 8);
+}
+
+DMD_CachedFont::DMD_CachedFont(uint8_t cacheGlyphs) :
+  column_bytes(1),
+  offsets(0),
+  ranges(0),
+  cache_glyphs(cacheGlyphs ? cacheGlyphs : 1),
+  slot_bytes(0),
+  slots(0),
+  cache_data(0),
+  use_count(0),
+  glyph_reads(0)
+{
+}
+
+DMD_CachedFont::~DMD_CachedFont()
+{
+  freeTables();
+}
+
+void DMD_CachedFont::freeTables()
+{
+  free(offsets);
+  free(ranges);
+  free(slots);
+  free(cache_data);
+  offsets = NULL;
+  ranges = NULL;
+  slots = NULL;
+  cache_data = NULL;
+}
+
+bool DMD_CachedFont::begin(FontHeader &font_header)
+{
+  freeTables();
+  if(!readAt(0, (uint8_t *)&header, sizeof(FontHeader)) || header.size == DMD_PACKED_FONT)
+    return false;
+  column_bytes = (header.height + 7) / 8;
+
+  uint8_t widest;
+  if(!readTables(widest)) {
+    freeTables();
+    return false;
+  }
+
+  // Each slot of the cache has room for the widest glyph
+  slot_bytes = widest * column_bytes;
+  slots = (Slot *)malloc(sizeof(Slot) * cache_glyphs);
+  cache_data = (uint8_t *)malloc(slot_bytes * cache_glyphs);
+  if(!slots || (slot_bytes && !cache_data)) {
+    freeTables();
+    return false;
+  }
+  for(uint8_t i = 0; i < cache_glyphs; i++) {
+    slots[i].letter = EMPTY_SLOT;
+    slots[i].loaded = false;
+    slots[i].last_used = 0;
+  }
+  use_count = 0;
+  font_header = header;
+  return true;
+}
+
+// Read the table of offsets or ranges into RAM, and find the widest glyph
+bool DMD_CachedFont::readTables(uint8_t &widest)
+{
+  widest = 0;
+  uint8_t buf[24];
+  if(header.size == DMD_SPARSE_FONT) {
+    uint16_t table_bytes = header.charCount * RANGE_BYTES;
+    ranges = (uint8_t *)malloc(table_bytes);
+    if(!ranges || !readAt(sizeof(FontHeader), ranges, table_bytes))
+      return false;
+    uint16_t glyphs = 0;
+    if(header.charCount) {
+      const uint8_t *last = ranges + table_bytes - RANGE_BYTES;
+      glyphs = readWord(last + 3) + last[2];
+    }
+    uint32_t pos = sizeof(FontHeader) + table_bytes;
+    const uint8_t batch = sizeof(buf) / ENTRY_BYTES;
+    for(uint16_t g = 0; g < glyphs; g += batch) {
+      uint8_t count = (glyphs - g < batch) ? glyphs - g : batch;
+      if(!readAt(pos + g * ENTRY_BYTES, buf, count * ENTRY_BYTES))
+        return false;
+      for(uint8_t i = 0; i < count; i++) {
+        if(buf[i * ENTRY_BYTES] > widest)
+          widest = buf[i * ENTRY_BYTES];
+      }
+    }
+  }
+  else if(header.size == 0) {
+    widest = header.fixedWidth; // fixed width font, offsets are easy to calculate
+  }
+  else {
+    offsets = (uint16_t *)malloc(sizeof(uint16_t) * (header.charCount + 1));
+    if(!offsets)
+      return false;
+    offsets[0] = sizeof(FontHeader) + header.charCount;
+    for(uint8_t c = 0; c < header.charCount; c += sizeof(buf)) {
+      uint8_t count = (header.charCount - c < (int)sizeof(buf)) ? header.charCount - c : sizeof(buf);
+      if(!readAt(sizeof(FontHeader) + c, buf, count))
+        return false;
+      for(uint8_t i = 0; i < count; i++) {
+        offsets[c + i + 1] = offsets[c + i] + buf[i] * column_bytes;
+        if(buf[i] > widest)
+          widest = buf[i];
+      }
+    }
+  }
+  return true;
+}
+
+// Find the width and data position of a glyph, returns false if it's not in the font
+bool DMD_CachedFont::findGlyph(uint16_t letter, uint8_t &width, uint16_t &index)
+{
+  if(header.size == DMD_SPARSE_FONT) {
+    if(!ranges || !header.charCount)
+      return false;
+    // Binary search for the last range starting at or before the letter, as DMDFrame::findSparseGlyph()
+    uint8_t lo = 0;
+    uint8_t hi = header.charCount;
+    while(hi - lo > 1) {
+      uint8_t mid = (lo + hi) / 2;
+      if(readWord(ranges + mid * RANGE_BYTES) <= letter)
+        lo = mid;
+      else
+        hi = mid;
+    }
+    const uint8_t *range = ranges + lo * RANGE_BYTES;
+    uint16_t first = readWord(range);
+    if(letter < first || letter - first >= range[2])
+      return false;
+    uint16_t entry = readWord(range + 3) + (letter - first);
+    uint8_t buf[ENTRY_BYTES];
+    if(!readAt(sizeof(FontHeader) + header.charCount * RANGE_BYTES + entry * ENTRY_BYTES, buf, ENTRY_BYTES))
+      return false;
+    width = buf[0];
+    index = readWord(buf + 1);
+    return true;
+  }
+
+  if(letter < header.firstChar || letter >= header.firstChar + header.charCount)
+    return false;
+  uint8_t c = letter - header.firstChar;
+  if(header.size == 0) {
+    width = header.fixedWidth;
+    index = sizeof(FontHeader) + c * column_bytes * width;
+    return true;
+  }
+  if(!offsets)
+    return false;
+  index = offsets[c];
+  width = (offsets[c + 1] - index) / column_bytes;
+  return true;
+}
+
+DMD_CachedFont::Slot *DMD_CachedFont::findSlot(uint16_t letter)
+{
+  if(!slots)
+    return NULL;
+  for(uint8_t i = 0; i < cache_glyphs; i++) {
+    if(slots[i].letter == letter)
+      return &slots[i];
+  }
+  return NULL;
+}
+
+// Find a glyph's slot, or look the glyph up and give it the least recently used slot
+// (without reading its data yet.) Returns NULL if the glyph isn't in the font.
+DMD_CachedFont::Slot *DMD_CachedFont::loadSlot(uint16_t letter)
+{
+  Slot *slot = findSlot(letter);
+  if(slot || !slots)
+    return slot;
+  uint8_t width;
+  uint16_t index;
+  if(!findGlyph(letter, width, index) || width * column_bytes > slot_bytes)
+    return NULL;
+  slot = &slots[0];
+  for(uint8_t i = 1; i < cache_glyphs; i++) {
+    if(slots[i].last_used < slot->last_used)
+      slot = &slots[i];
+  }
+  slot->letter = letter;
+  slot->width = width;
+  slot->index = index;
+  slot->loaded = false;
+  return slot;
+}
+
+void DMD_CachedFont::touchSlot(Slot *slot)
+{
+  if(++use_count == 0) {
+    // count wrapped around, start again (forgets the order of the other glyphs)
+    for(uint8_t i = 0; i < cache_glyphs; i++)
+      slots[i].last_used = 0;
+    use_count = 1;
+  }
+  slot->last_used = use_count;
+}
+
+uint8_t DMD_CachedFont::charWidth(uint16_t letter)
+{
+  if(header.size == DMD_SPARSE_FONT) {
+    // Looking up a sparse glyph costs a read, so keep it for drawing the glyph
+    Slot *slot = loadSlot(letter);
+    if(!slot)
+      return 0;
+    touchSlot(slot);
+    return slot->width;
+  }
+  Slot *slot = findSlot(letter);
+  if(slot)
+    return slot->width;
+  uint8_t width;
+  uint16_t index;
+  return findGlyph(letter, width, index) ? width : 0;
+}
+
+const uint8_t *DMD_CachedFont::glyphData(uint16_t letter, uint8_t &width)
+{
+  Slot *slot = loadSlot(letter);
+  if(!slot)
+    return NULL;
+  uint8_t *data = cache_data + (slot - slots) * slot_bytes;
+  if(!slot->loaded) {
+    if(!readAt(slot->index, data, slot->width * column_bytes)) {
+      slot->letter = EMPTY_SLOT;
+      slot->last_used = 0;
+      return NULL;
+    }
+    slot->loaded = true;
+    glyph_reads++;
+  }
+  touchSlot(slot);
+  width = slot->width;
+  return data;
+}
@@ -0,0 +1,120 @@
+/*
+ DMD frame comparison, hashing and pixel counting
+
+ Comparing and counting read the bitmap a word at a time (or a byte at a
+ time on AVR, which has no wider loads), hashing goes a byte at a time.
+ All of them go a row at a time so ring rows mode and the layout of rows
+ of panels in the bitmap don't matter. Bits past the right edge of a
+ frame whose width isn't a multiple of 8 are ignored.
+
+ Copyright (C) 2014 Freetronics, Inc. (info <at> freetronics <dot> com)
+
+---
+
+ This program is free software: you can redistribute it and/or modify it under the terms
+ of the version 3 GNU General Public License as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program.
+ If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "DMD2.h"
+
+#ifdef __AVR__
+typedef uint8_t bitmap_word_t;
+#else
+typedef uint32_t bitmap_word_t;
+#endif
+
+const uint32_t FNV_PRIME = 16777619UL;
+
+// Load a word from the bitmap (memcpy so it needn't be aligned, compiles to a single load where possible)
+static inline bitmap_word_t loadWord(const volatile uint8_t *p)
+{
+  bitmap_word_t word;
+  memcpy(&word, (const uint8_t *)p, sizeof(word));
+  return word;
+}
+
+static inline uint8_t popcount(bitmap_word_t word)
+{
+#ifdef __AVR__
+  // no popcount instruction, nibble at a time is smaller & faster than the libgcc version
+  static const uint8_t nibble_bits[16] PROGMEM = { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 };
+  return pgm_read_byte(nibble_bits + (word & 0x0F)) + pgm_read_byte(nibble_bits + (word >> 4));
+#else
+  return __builtin_popcountl(word);
+#endif
+}
+
+// Mask of the bits of the last byte of each row that are pixels in the frame
+static inline uint8_t lastByteMask(byte width)
+{
+  return (width & 7) ? (uint8_t)(0xFF << (8 - (width & 7))) : 0xFF;
+}
+
+bool DMDFrame::operator==(DMDFrame &other)
+{
+  if (other.width != width || other.height != height)
+    return false;
+  uint8_t full = row_width_bytes - ((width & 7) ? 1 : 0); // bytes with no padding bits
+  uint8_t mask = lastByteMask(width);
+  for (unsigned int y = 0; y < height; y++) {
+    const volatile uint8_t *a = bitmap + rowToBitmapIndex(y);
+    const volatile uint8_t *b = other.bitmap + other.rowToBitmapIndex(y);
+    uint8_t i = 0;
+    for (; i + sizeof(bitmap_word_t) <= full; i += sizeof(bitmap_word_t)) {
+      if (loadWord(a + i) != loadWord(b + i))
+        return false;
+    }
+    for (; i < full; i++) {
+      if (a[i] != b[i])
+        return false;
+    }
+    if (full < row_width_bytes && ((a[full] ^ b[full]) & mask))
+      return false;
+  }
+  return true;
+}
+
+uint32_t DMDFrame::rowHash(unsigned int y, uint32_t hash)
+{
+  if (y >= height)
+    return hash;
+  const volatile uint8_t *row = bitmap + rowToBitmapIndex(y);
+  uint8_t full = row_width_bytes - ((width & 7) ? 1 : 0);
+  // (A byte at a time as FNV-1a is meant to be, mixing in whole words leaves their top bits poorly mixed)
+  for (uint8_t i = 0; i < full; i++)
+    hash = (hash ^ row[i]) * FNV_PRIME;
+  if (full < row_width_bytes)
+    hash = (hash ^ (uint8_t)(row[full] | ~lastByteMask(width))) * FNV_PRIME; // padding bits as off
+  return hash;
+}
+
+uint32_t DMDFrame::pixelHash()
+{
+  uint32_t hash = DMD_HASH_START;
+  for (unsigned int y = 0; y < height; y++)
+    hash = rowHash(y, hash);
+  return hash;
+}
+
+unsigned int DMDFrame::countPixelsOn()
+{
+  unsigned int count = 0;
+  uint8_t full = row_width_bytes - ((width & 7) ? 1 : 0);
+  for (unsigned int y = 0; y < height; y++) {
+    const volatile uint8_t *row = bitmap + rowToBitmapIndex(y);
+    uint8_t i = 0;
+    for (; i + sizeof(bitmap_word_t) <= full; i += sizeof(bitmap_word_t))
+      count += popcount(~loadWord(row + i)); // bits set = off
+    for (; i < full; i++)
+      count += popcount((uint8_t)~row[i]);
+    if (full < row_width_bytes)
+      count += popcount((uint8_t)(~row[full] & lastByteMask(width)));
+  }
+  return count;
+}
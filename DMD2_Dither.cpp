@@ -0,0 +1,178 @@
+/*
+ DMD dithering implementation
+
+ Draws greyscale pixels into a frame as they arrive, with a threshold,
+ an ordered (Bayer) dither or Floyd-Steinberg error diffusion. Output
+ pixels are packed into a byte at a time, then copied into the row of
+ the bitmap.
+
+ Copyright (C) 2014 Freetronics, Inc. (info <at> freetronics <dot> com)
+
+---
+
+ This program is free software: you can redistribute it and/or modify it under the terms
+ of the version 3 GNU General Public License as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program.
+ If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "DMD2.h"
+
+/* 8x8 Bayer matrix as thresholds for 8 bit pixels: a pixel at x,y is on if its value is greater
+   than bayer_thresholds[y & 7][x & 7]. (Index 0-63, times 4 plus 2 to sit between the levels.) */
+static const uint8_t bayer_thresholds[8][8] PROGMEM = {
+  {   2, 130,  34, 162,  10, 138,  42, 170 },
+  { 194,  66, 226,  98, 202,  74, 234, 106 },
+  {  50, 178,  18, 146,  58, 186,  26, 154 },
+  { 242, 114, 210,  82, 250, 122, 218,  90 },
+  {  14, 142,  46, 174,   6, 134,  38, 166 },
+  { 206,  78, 238, 110, 198,  70, 230, 102 },
+  {  62, 190,  30, 158,  54, 182,  22, 150 },
+  { 254, 126, 222,  94, 246, 118, 214,  86 },
+};
+
+DMD_Dither::DMD_Dither(DMDFrame &frame, DMDDitherMethod method, DMDGreyFormat format,
+                       int left, int top, int width, int height) :
+  frame(frame),
+  method(method),
+  format(format),
+  left(left),
+  top(top),
+  width(width),
+  height(height),
+  x(0),
+  y(0),
+  out(0),
+  out_count(0),
+  errors(NULL),
+  error_right(0),
+  error_below_right(0)
+{
+  if(left < 0 || left >= (int)frame.width || top < 0 || top >= (int)frame.height) {
+    this->width = 0;
+    this->height = 0;
+    return;
+  }
+  if(width <= 0 || left + width > (int)frame.width)
+    this->width = frame.width - left;
+  if(height <= 0 || top + height > (int)frame.height)
+    this->height = frame.height - top;
+}
+
+DMD_Dither::~DMD_Dither()
+{
+  free(errors);
+}
+
+// Allocate the error buffer the first time it's needed
+bool DMD_Dither::begin()
+{
+  if(method != DITHER_FLOYD_STEINBERG || errors)
+    return true;
+  errors = (int16_t *)malloc(width * sizeof(int16_t));
+  if(!errors)
+    return false;
+  memset(errors, 0, width * sizeof(int16_t));
+  return true;
+}
+
+void DMD_Dither::restart()
+{
+  x = 0;
+  y = 0;
+  out = 0;
+  out_count = 0;
+  error_right = 0;
+  error_below_right = 0;
+  if(errors)
+    memset(errors, 0, width * sizeof(int16_t));
+}
+
+size_t DMD_Dither::write(uint8_t value)
+{
+  if(done() || !begin())
+    return 0;
+  if(format == GREY_4BIT) {
+    bool row_end = (x == width - 1); // low nibble is padding
+    pixel((value >> 4) * 17);
+    if(!row_end)
+      pixel((value & 0x0F) * 17);
+  }
+  else {
+    pixel(value);
+  }
+  return 1;
+}
+
+void DMD_Dither::writeRow(const uint8_t *row)
+{
+  int bytes = (format == GREY_4BIT) ? (width + 1) / 2 : width;
+  for(int i = 0; i < bytes; i++)
+    write(row[i]);
+}
+
+#if defined(__AVR__) || defined(ESP8266)
+void DMD_Dither::writeRow_P(const uint8_t *row)
+{
+  int bytes = (format == GREY_4BIT) ? (width + 1) / 2 : width;
+  for(int i = 0; i < bytes; i++)
+    write(pgm_read_byte(row + i));
+}
+#endif
+
+void DMD_Dither::pixel(uint8_t value)
+{
+  bool on;
+  switch(method) {
+  case DITHER_BAYER:
+    on = value > pgm_read_byte(&bayer_thresholds[(top + y) & 7][(left + x) & 7]);
+    break;
+
+  case DITHER_FLOYD_STEINBERG: {
+    /* errors[] holds one row of errors. Left of x it's the errors already pushed onto the next
+       row, from x on it's the errors from the row above for the pixels still to come. Each
+       pixel's error goes 7/16 right, 3/16 below left, 5/16 below and 1/16 below right. */
+    int16_t level = value + errors[x] + error_right;
+    on = level >= 128;
+    int16_t error = level - (on ? 255 : 0);
+    int16_t right = error * 7 / 16;
+    int16_t below_left = error * 3 / 16;
+    int16_t below = error * 5 / 16;
+    if(x > 0)
+      errors[x - 1] += below_left;
+    errors[x] = below + error_below_right;
+    error_right = right;
+    error_below_right = error - right - below_left - below; // (the rest, so none is lost)
+    break;
+  }
+
+  default: // DITHER_THRESHOLD
+    on = value >= 128;
+    break;
+  }
+
+  out = (out << 1) | (on ? 0 : 1); // bits set = off
+  out_count++;
+  x++;
+  if(out_count == 8 || x == width)
+    flush();
+  if(x == width) {
+    x = 0;
+    y++;
+    error_right = 0;
+    error_below_right = 0;
+  }
+}
+
+// Copy the pixels packed into 'out' into the frame, they end just before x
+void DMD_Dither::flush()
+{
+  uint8_t bits = out << (8 - out_count); // first pixel in the MSB
+  DMDFrame::copyRowBits(frame.bitmap + frame.rowToBitmapIndex(top + y), left + x - out_count, &bits, 0, out_count);
+  out = 0;
+  out_count = 0;
+}
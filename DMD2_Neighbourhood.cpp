@@ -0,0 +1,154 @@
+/*
+ DMD neighbourhood operations
+
+ Life-like cellular automata and morphology (dilate, erode, outline),
+ where each new pixel depends on the 3x3 block of pixels around it. Eight
+ pixels are worked out at once from the bytes of the bitmap, with the
+ neighbour counts for Life kept as bit planes (bit-sliced adders) rather
+ than counted pixel by pixel.
+
+ The frame is updated in place, a row at a time. Copies of the original
+ rows above, at and below the current row are kept in a small line buffer.
+
+ Copyright (C) 2014 Freetronics, Inc. (info <at> freetronics <dot> com)
+
+---
+
+ This program is free software: you can redistribute it and/or modify it under the terms
+ of the version 3 GNU General Public License as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program.
+ If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "DMD2.h"
+
+const uint8_t MAX_ROW_BYTES = 32; // frames are at most 255 pixels wide
+
+// The 3x3 neighbourhood of 8 pixels, each bit set if that pixel's neighbour is on
+struct Neighbours {
+  uint8_t ul, u, ur;
+  uint8_t l, c, r;
+  uint8_t dl, d, dr;
+};
+
+// Pixels left and right of each pixel of byte i of a row of on bits (pixels off the ends are off)
+static inline void rowNeighbours(const uint8_t *row, uint8_t i, uint8_t row_bytes, uint8_t &left, uint8_t &centre, uint8_t &right)
+{
+  centre = row[i];
+  left = centre >> 1;
+  if (i > 0)
+    left |= row[i - 1] << 7;
+  right = centre << 1;
+  if (i + 1 < row_bytes)
+    right |= row[i + 1] >> 7;
+}
+
+/* Next state of 8 cells. The 8 neighbours are added up as a 4 bit number in bit planes
+   (ones, twos, fours, eights), each holding that bit of the count for all 8 cells. */
+static inline uint8_t lifeBits(const Neighbours &n, uint16_t birth, uint16_t survive)
+{
+  // rows above & below: full adders, 0-3 each
+  uint8_t up_ones = n.ul ^ n.u ^ n.ur;
+  uint8_t up_twos = (n.ul & n.u) | (n.ur & (n.ul ^ n.u));
+  uint8_t down_ones = n.dl ^ n.d ^ n.dr;
+  uint8_t down_twos = (n.dl & n.d) | (n.dr & (n.dl ^ n.d));
+  // left & right: half adder, 0-2
+  uint8_t mid_ones = n.l ^ n.r;
+  uint8_t mid_twos = n.l & n.r;
+
+  // add the three partial sums
+  uint8_t ones = up_ones ^ down_ones ^ mid_ones;
+  uint8_t carry = (up_ones & down_ones) | (mid_ones & (up_ones ^ down_ones));
+  uint8_t twos_a = up_twos ^ down_twos ^ mid_twos;
+  uint8_t fours_a = (up_twos & down_twos) | (mid_twos & (up_twos ^ down_twos));
+  uint8_t twos = twos_a ^ carry;
+  uint8_t fours_b = twos_a & carry;
+  uint8_t fours = fours_a ^ fours_b;
+  uint8_t eights = fours_a & fours_b;
+
+  // cells where the count is one that the rule turns (or keeps) on
+  uint8_t born = 0;
+  uint8_t stay = 0;
+  for (uint8_t count = 0; count <= 8; count++) {
+    if (!((birth | survive) >> count & 1))
+      continue;
+    uint8_t match = (count & 1 ? ones : ~ones) & (count & 2 ? twos : ~twos)
+      & (count & 4 ? fours : ~fours) & (count & 8 ? eights : ~eights);
+    if (birth >> count & 1)
+      born |= match;
+    if (survive >> count & 1)
+      stay |= match;
+  }
+  return (born & ~n.c) | (stay & n.c);
+}
+
+bool DMDFrame::neighbourhoodStep(uint8_t op, uint16_t birth, uint16_t survive)
+{
+  // original pixels of the rows above, at & below the one being updated, as on bits
+  uint8_t buffer[3][MAX_ROW_BYTES];
+  uint8_t *above = buffer[0];
+  uint8_t *here = buffer[1];
+  uint8_t *below = buffer[2];
+
+  // pixels past the right edge of the frame in the last byte of each row
+  uint8_t last = row_width_bytes - 1;
+  uint8_t valid = (width & 7) ? (uint8_t)(0xFF << (8 - (width & 7))) : 0xFF;
+
+  memset(here, 0, row_width_bytes); // (becomes the row above row 0)
+  for (uint8_t i = 0; i < row_width_bytes; i++)
+    below[i] = ~bitmap[rowToBitmapIndex(0) + i];
+  below[last] &= valid;
+
+  bool changed = false;
+  for (unsigned int y = 0; y < height; y++) {
+    uint8_t *tmp = above;
+    above = here;
+    here = below;
+    below = tmp;
+    if (y + 1 < height) {
+      volatile uint8_t *next = bitmap + rowToBitmapIndex(y + 1);
+      for (uint8_t i = 0; i < row_width_bytes; i++)
+        below[i] = ~next[i];
+      below[last] &= valid;
+    } else {
+      memset(below, 0, row_width_bytes);
+    }
+
+    volatile uint8_t *row = bitmap + rowToBitmapIndex(y);
+    for (uint8_t i = 0; i < row_width_bytes; i++) {
+      Neighbours n;
+      rowNeighbours(above, i, row_width_bytes, n.ul, n.u, n.ur);
+      rowNeighbours(here, i, row_width_bytes, n.l, n.c, n.r);
+      rowNeighbours(below, i, row_width_bytes, n.dl, n.d, n.dr);
+
+      uint8_t on;
+      switch (op) {
+      case NEIGHBOURHOOD_LIFE:
+        on = lifeBits(n, birth, survive);
+        break;
+      case NEIGHBOURHOOD_DILATE:
+        on = n.ul | n.u | n.ur | n.l | n.c | n.r | n.dl | n.d | n.dr;
+        break;
+      case NEIGHBOURHOOD_ERODE:
+        on = n.ul & n.u & n.ur & n.l & n.c & n.r & n.dl & n.d & n.dr;
+        break;
+      default: // NEIGHBOURHOOD_OUTLINE
+        on = n.c & ~(n.ul & n.u & n.ur & n.l & n.r & n.dl & n.d & n.dr);
+        break;
+      }
+
+      uint8_t mask = (i == last) ? valid : 0xFF;
+      uint8_t old = row[i];
+      uint8_t res = (old & ~mask) | (~on & mask); // bits set = off
+      if (res != old) {
+        row[i] = res;
+        changed = true;
+      }
+    }
+  }
+  return changed;
+}
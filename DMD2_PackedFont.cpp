@@ -0,0 +1,98 @@
+/*
+ DMD packed font support
+
+ Packed fonts (see DMD_PACKED_FONT and extras/fontpack.py) store the
+ rows of each glyph column as a continuous bit stream, only covering the
+ rows between the glyph's top and bottom pixels.
+
+ Copyright (C) 2014 Freetronics, Inc. (info <at> freetronics <dot> com)
+
+---
+
+ This program is free software: you can redistribute it and/or modify it under the terms
+ of the version 3 GNU General Public License as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program.
+ If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "DMD2.h"
+
+// Read the next 'count' bits (up to 32) from PROGMEM, least significant bit first,
+// starting at bit 'bit' of *data. Moves data/bit on past them.
+static inline uint32_t readPackedBits(const uint8_t *&data, uint8_t &bit, uint8_t count)
+{
+  uint32_t res = 0;
+  uint8_t got = 0;
+  while(got < count) {
+    uint8_t avail = 8 - bit;
+    uint8_t take = (count - got < avail) ? count - got : avail;
+    uint8_t bits = (pgm_read_byte(data) >> bit) & (0xFF >> (8 - take));
+    res |= (uint32_t)bits << got;
+    got += take;
+    bit += take;
+    if(bit == 8) {
+      bit = 0;
+      data++;
+    }
+  }
+  return res;
+}
+
+uint32_t DMDFrame::packedColumn(const uint8_t *data, uint8_t column)
+{
+  uint8_t glyph_top = pgm_read_byte(data);
+  uint8_t rows = pgm_read_byte(data + 1);
+  uint16_t start = column * rows;
+  const uint8_t *src = data + 2 + start / 8;
+  uint8_t bit = start % 8;
+  return readPackedBits(src, bit, rows) << glyph_top;
+}
+
+/* Same as drawGlyph(), except each column is read as one bit stream. Pixels outside the
+   glyph's stored rows are clear, and are still drawn (with inverseMode(mode)) so the
+   result is identical to drawing the original font. */
+void DMDFrame::drawPackedGlyph(int x, int y, const uint8_t *data, uint8_t glyph_width, uint8_t glyph_height, DMDGraphicsMode mode)
+{
+  DMDGraphicsMode set_mode = (mode == GRAPHICS_INVERSE) ? GRAPHICS_OFF : mode;
+  DMDGraphicsMode clear_mode = inverseMode(mode);
+
+  uint8_t glyph_top = pgm_read_byte(data);
+  uint8_t rows = pgm_read_byte(data + 1);
+
+  int first_col = (x < 0) ? -x : 0;
+  int end_col = glyph_width;
+  if (x + end_col > (int)width)
+    end_col = width - x;
+  // (single byte fonts also draw the blank row below the glyph, as drawGlyph() does)
+  int first_row = (y < 0) ? -y : 0;
+  int end_row = (glyph_height < 8) ? glyph_height + 1 : glyph_height;
+  if (y + end_row > (int)height)
+    end_row = height - y;
+  if (first_col >= end_col || first_row >= end_row)
+    return;
+
+  int row_index[32];
+  for (int k = first_row; k < end_row; k++)
+    row_index[k] = rowToBitmapIndex(y + k);
+
+  uint16_t start = first_col * rows;
+  const uint8_t *src = data + 2 + start / 8;
+  uint8_t bit = start % 8;
+  for (int j = first_col; j < end_col; j++) { // Width
+    uint32_t bits = (readPackedBits(src, bit, rows) << glyph_top) >> first_row;
+    unsigned int px = x + j;
+    uint8_t mask = pixelToBitmask(px);
+    DMDBitOp set_op = modeBitOp(set_mode, mask);
+    DMDBitOp clear_op = modeBitOp(clear_mode, mask);
+    volatile uint8_t *col = bitmap + px / 8;
+    for (int k = first_row; k < end_row; k++) { // Vertical bits
+      volatile uint8_t *dest = col + row_index[k];
+      *dest = (bits & 1) ? set_op.apply(*dest) : clear_op.apply(*dest);
+      bits >>= 1;
+    }
+  }
+}
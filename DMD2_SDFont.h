@@ -0,0 +1,74 @@
+/*
+ DMD_SDFont, a font read from a file on an SD card
+
+ Fonts too big for flash can be kept on an SD card instead. Copy the font
+ to the card as a binary file (extras/fontbin.py converts one of the font
+ headers in fonts/), then select it:
+
+   #include <SD.h>
+   #include <DMD2.h>
+   #include <DMD2_SDFont.h>
+
+   DMD_SDFont bigFont("DROID24.FNT");
+   ...
+   SD.begin(SD_CS);
+   dmd.setOtherCS(SD_CS); // don't scan the display while the card is in use
+   dmd.selectFont(bigFont);
+   dmd.drawString(0, 0, "Hello");
+
+ Only glyphs that aren't in the cache (see DMD_CachedFont in DMD2.h) are
+ read from the card. This header isn't included by DMD2.h, so sketches
+ that don't use it don't need the SD library.
+
+ Copyright (C) 2014 Freetronics, Inc. (info <at> freetronics <dot> com)
+
+---
+
+ This program is free software: you can redistribute it and/or modify it under the terms
+ of the version 3 GNU General Public License as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program.
+ If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef DMD2_SDFONT_H
+#define DMD2_SDFONT_H
+
+#include <SD.h>
+#include "DMD2.h"
+
+class DMD_SDFont : public DMD_CachedFont {
+public:
+  DMD_SDFont(const char *path, uint8_t cacheGlyphs = DMD_FONT_CACHE_GLYPHS)
+    : DMD_CachedFont(cacheGlyphs), path(path) { }
+  ~DMD_SDFont() {
+    if(file)
+      file.close();
+  }
+
+  // (Re)opens the file, called by DMDFrame::selectFont()
+  virtual bool begin(FontHeader &header) {
+    if(file)
+      file.close();
+    file = SD.open(path);
+    if(!file)
+      return false;
+    return DMD_CachedFont::begin(header);
+  }
+
+protected:
+  virtual bool readAt(uint32_t position, uint8_t *buf, uint16_t length) {
+    if(!file || !file.seek(position))
+      return false;
+    return file.read(buf, length) == length;
+  }
+
+private:
+  const char *path;
+  File file;
+};
+
+#endif
@@ -0,0 +1,261 @@
+/*
+ DMD scaled text
+
+ Draws text from any font at an integer scale, so one small font can be
+ used for large digits on a display several panels high. Each glyph row
+ is widened with a table lookup per nibble and then written to 'scale'
+ rows of the bitmap a byte at a time, rather than drawing a block of
+ pixels for every pixel of the glyph.
+
+ Copyright (C) 2014 Freetronics, Inc. (info <at> freetronics <dot> com)
+
+---
+
+ This program is free software: you can redistribute it and/or modify it under the terms
+ of the version 3 GNU General Public License as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program.
+ If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "DMD2.h"
+
+// Each nibble with every bit repeated 2, 3 or 4 times (MSB first)
+static const uint16_t expand_nibble[3][16] PROGMEM = {
+  { 0x00, 0x03, 0x0C, 0x0F, 0x30, 0x33, 0x3C, 0x3F, 0xC0, 0xC3, 0xCC, 0xCF, 0xF0, 0xF3, 0xFC, 0xFF },
+  { 0x000, 0x007, 0x038, 0x03F, 0x1C0, 0x1C7, 0x1F8, 0x1FF, 0xE00, 0xE07, 0xE38, 0xE3F, 0xFC0, 0xFC7, 0xFF8, 0xFFF },
+  { 0x0000, 0x000F, 0x00F0, 0x00FF, 0x0F00, 0x0F0F, 0x0FF0, 0x0FFF, 0xF000, 0xF00F, 0xF0F0, 0xF0FF, 0xFF00, 0xFF0F, 0xFFF0, 0xFFFF },
+};
+
+// Repeat each bit of 'bits' (MSB first) 'scale' times, returns the result aligned to the top of
+// the word. Only the top 32 bits are kept, so scale * the number of bits used should be 32 or less.
+static inline uint32_t expandBits(uint8_t bits, uint8_t scale)
+{
+  if (scale >= 2 && scale <= 4) {
+    const uint16_t *table = expand_nibble[scale - 2];
+    uint32_t res = ((uint32_t)pgm_read_word(table + (bits >> 4)) << (4 * scale)) | pgm_read_word(table + (bits & 0x0F));
+    return res << (32 - 8 * scale);
+  }
+  uint32_t res = 0;
+  uint8_t shift = 32;
+  for (uint8_t mask = 0x80; mask && shift >= scale; mask >>= 1) {
+    shift -= scale;
+    if (bits & mask)
+      res |= (0xFFFFFFFFUL >> (32 - scale)) << shift;
+  }
+  return res;
+}
+
+// Pixels of one column of FontCreator glyph data, bit 0 is the top row of the glyph
+static uint32_t glyphColumn(const uint8_t *data, uint8_t glyph_width, uint8_t glyph_height, uint8_t column, bool in_ram)
+{
+  uint32_t res = 0;
+  uint8_t bytes = (glyph_height + 7) / 8;
+  if (bytes > 4)
+    bytes = 4;
+  for (uint8_t i = 0; i < bytes; i++) {
+    const uint8_t *p = data + column + i * glyph_width;
+    uint8_t bits = in_ram ? *p : pgm_read_byte(p);
+    // Last byte of a multi-byte column is aligned to the bottom of the glyph, as for drawGlyph()
+    if (i == bytes - 1 && i > 0 && glyph_height < (i + 1) * 8)
+      bits >>= (i + 1) * 8 - glyph_height;
+    res |= (uint32_t)bits << (i * 8);
+  }
+  return res;
+}
+
+// Draw 'count' pixels (up to 32, MSB first in 'bits') at bit 'dest_x' of the row at 'dest',
+// with set_mode for the bits that are set and clear_mode for the others
+static inline void drawRowBits(volatile uint8_t *dest, unsigned int dest_x, uint32_t bits, uint8_t count,
+                               DMDGraphicsMode set_mode, DMDGraphicsMode clear_mode)
+{
+  dest += dest_x / 8;
+  uint8_t dest_bit = dest_x & 7;
+  while (count) {
+    uint8_t n = 8 - dest_bit;
+    if (n > count)
+      n = count;
+    uint8_t mask = (uint8_t)(0xFF << (8 - n)) >> dest_bit;
+    uint8_t on = ((uint8_t)(bits >> 24) >> dest_bit) & mask;
+    *dest = modeBitOp(clear_mode, mask & ~on).apply(modeBitOp(set_mode, on).apply(*dest));
+    bits <<= n;
+    dest++;
+    dest_bit = 0;
+    count -= n;
+  }
+}
+
+/* Glyph columns are read 32/scale (at most 8) at a time, then each glyph row of those
+   columns is gathered into a byte, widened by expandBits() and drawn to 'scale' rows.
+
+   Unlike drawGlyph(), exactly glyph_height * scale rows are drawn (single byte fonts don't
+   also draw the blank row below the glyph.) Fonts up to 32 pixels high can be scaled.
+*/
+void DMDFrame::drawScaledGlyph(int x, int y, const uint8_t *data, uint8_t glyph_width, const FontHeader &header,
+                               uint8_t scale, DMDGraphicsMode mode, bool in_ram)
+{
+  DMDGraphicsMode set_mode = (mode == GRAPHICS_INVERSE) ? GRAPHICS_OFF : mode;
+  DMDGraphicsMode clear_mode = inverseMode(mode);
+  uint8_t glyph_height = (header.height > 32) ? 32 : header.height;
+
+  int first_row = (y < 0) ? -y : 0;
+  int end_row = glyph_height * scale;
+  if (y + end_row > (int)height)
+    end_row = height - y;
+  if (first_row >= end_row)
+    return;
+
+  uint8_t chunk = 32 / scale;
+  if (chunk > 8)
+    chunk = 8;
+  uint32_t columns[8];
+  for (uint8_t c0 = 0; c0 < glyph_width; c0 += chunk) {
+    uint8_t n = (glyph_width - c0 < chunk) ? glyph_width - c0 : chunk;
+    int px = x + c0 * scale;
+    if (px >= (int)width)
+      break;
+    uint8_t count = n * scale;
+    uint8_t skip = 0;
+    if (px < 0) {
+      if (-px >= count)
+        continue;
+      skip = -px;
+      count -= skip;
+      px = 0;
+    }
+    if (px + count > (int)width)
+      count = width - px;
+
+    for (uint8_t k = 0; k < n; k++) {
+      if (!data)
+        columns[k] = 0;
+      else if (header.size == DMD_PACKED_FONT)
+        columns[k] = packedColumn(data, c0 + k);
+      else
+        columns[k] = glyphColumn(data, glyph_width, header.height, c0 + k, in_ram);
+    }
+
+    for (int row = first_row; row < end_row; ) {
+      uint8_t glyph_row = row / scale;
+      uint8_t bits = 0;
+      for (uint8_t k = 0; k < n; k++) {
+        if ((columns[k] >> glyph_row) & 1)
+          bits |= 0x80 >> k;
+      }
+      uint32_t expanded = expandBits(bits, scale) << skip;
+      // the same pixels for every screen row this glyph row covers
+      int next_row = (glyph_row + 1) * scale;
+      if (next_row > end_row)
+        next_row = end_row;
+      for (; row < next_row; row++)
+        drawRowBits(bitmap + rowToBitmapIndex(y + row), px, expanded, count, set_mode, clear_mode);
+    }
+  }
+}
+
+int DMDFrame::drawCodepointScaled(const int x, const int y, uint16_t letter, uint8_t scale, DMDGraphicsMode mode, const uint8_t *font)
+{
+  if (scale <= 1)
+    return drawCodepoint(x, y, letter, mode, font);
+  if (scale > 32)
+    scale = 32;
+  if (!font)
+    font = this->font;
+  if (x >= (int)width || y >= height)
+    return -1;
+
+  struct FontHeader scratch;
+  const FontHeader &header = *getFontHeader(font, scratch);
+
+  uint8_t width;
+  uint16_t index;
+  const uint8_t *data;
+  if (letter == ' ') {
+    width = header.fixedWidth;
+    data = NULL;
+  }
+  else if (!font) {
+    data = font_source ? font_source->glyphData(letter, width) : NULL;
+    if (!data)
+      return 0;
+  }
+  else {
+    if (!findGlyph(font, &header, letter, width, index))
+      return 0;
+    data = font + index;
+  }
+
+  if (x > -width * scale && y > -header.height * scale)
+    drawScaledGlyph(x, y, data, width, header, scale, mode, !font);
+  return width * scale;
+}
+
+// Generic drawStringScaled implementation, same as _drawString() in DMD2_Text.cpp
+template <class StrType> __attribute__((always_inline)) inline void _drawStringScaled(DMDFrame *dmd, int x, int y, StrType str, uint8_t scale, DMDGraphicsMode mode, const uint8_t *font)
+{
+  struct FontHeader scratch;
+  const FontHeader &header = *dmd->getFontHeader(font, scratch);
+
+  if (y + header.height * scale < 0)
+    return;
+
+  int strWidth = 0;
+  if (x > 0)
+    dmd->drawScaledGlyph(x - scale, y, NULL, 1, header, scale, mode);
+
+  bool utf8 = (header.size == DMD_SPARSE_FONT);
+  DMD_UTF8Decoder decoder;
+  char c;
+  for (int idx = 0; c = str[idx], c != 0; idx++) {
+    uint16_t letter = (uint8_t)c;
+    if (utf8 && (letter = decoder.decode(c)) == DMD_UTF8_PENDING)
+      continue;
+    if (letter == '\n') { // Newline
+      strWidth = 0;
+      y = y - (header.height + 1) * scale;
+    }
+    else {
+      int charWide = dmd->drawCodepointScaled(x + strWidth, y, letter, scale, mode, font);
+      if (charWide > 0) {
+        strWidth += charWide;
+        dmd->drawScaledGlyph(x + strWidth, y, NULL, 1, header, scale, mode);
+        strWidth += scale;
+      } else if (charWide < 0) {
+        return;
+      }
+    }
+  }
+}
+
+void DMDFrame::drawStringScaled(int x, int y, const char *bChars, uint8_t scale, DMDGraphicsMode mode, const uint8_t *font)
+{
+  if (scale <= 1) {
+    drawString(x, y, bChars, mode, font);
+    return;
+  }
+  if (scale > 32)
+    scale = 32;
+  if (!font)
+    font = this->font;
+  if (x >= (int)width || y >= height)
+    return;
+  _drawStringScaled(this, x, y, bChars, scale, mode, font);
+}
+
+void DMDFrame::drawStringScaled(int x, int y, const String &str, uint8_t scale, DMDGraphicsMode mode, const uint8_t *font)
+{
+  if (scale <= 1) {
+    drawString(x, y, str, mode, font);
+    return;
+  }
+  if (scale > 32)
+    scale = 32;
+  if (!font)
+    font = this->font;
+  if (x >= (int)width || y >= height)
+    return;
+  _drawStringScaled(this, x, y, str, scale, mode, font);
+}
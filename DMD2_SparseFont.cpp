@@ -0,0 +1,89 @@
+/*
+ DMD sparse font support
+
+ Sparse fonts (see DMD_SPARSE_FONT and extras/fontsparse.py) hold any
+ set of characters up to U+FFFF, found by a binary search of a table of
+ ranges of consecutive characters. Text drawn in them is read as UTF-8.
+
+ Copyright (C) 2014 Freetronics, Inc. (info <at> freetronics <dot> com)
+
+---
+
+ This program is free software: you can redistribute it and/or modify it under the terms
+ of the version 3 GNU General Public License as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program.
+ If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "DMD2.h"
+
+// After the header: 'charCount' ranges, then an entry for each glyph, then the glyph data
+const uint8_t SPARSE_RANGE_BYTES = 5; // first character (2), glyph count (1), first glyph's entry number (2)
+const uint8_t SPARSE_GLYPH_BYTES = 3; // width (1), offset of the glyph data from the start of the font (2)
+
+// Read a little endian 16 bit value from PROGMEM (byte at a time, as it may not be aligned)
+static inline uint16_t readFontWord(const uint8_t *p)
+{
+  return pgm_read_byte(p) | (pgm_read_byte(p + 1) << 8);
+}
+
+bool DMDFrame::findSparseGlyph(const uint8_t *font, const FontHeader &header, uint16_t letter, uint8_t &width, uint16_t &index)
+{
+  if (!header.charCount)
+    return false;
+  const uint8_t *ranges = font + sizeof(FontHeader);
+
+  // Find the last range starting at or before the letter
+  uint8_t lo = 0;
+  uint8_t hi = header.charCount;
+  while (hi - lo > 1) {
+    uint8_t mid = (lo + hi) / 2;
+    if (readFontWord(ranges + mid * SPARSE_RANGE_BYTES) <= letter)
+      lo = mid;
+    else
+      hi = mid;
+  }
+
+  const uint8_t *range = ranges + lo * SPARSE_RANGE_BYTES;
+  uint16_t first = readFontWord(range);
+  if (letter < first || letter - first >= pgm_read_byte(range + 2))
+    return false;
+
+  uint16_t entry = readFontWord(range + 3) + (letter - first);
+  const uint8_t *glyph = ranges + header.charCount * SPARSE_RANGE_BYTES + entry * SPARSE_GLYPH_BYTES;
+  width = pgm_read_byte(glyph);
+  index = readFontWord(glyph + 1);
+  return true;
+}
+
+uint16_t DMD_UTF8Decoder::decodeSequence(uint8_t c)
+{
+  if ((c & 0xC0) == 0x80) { // continuation byte
+    if (!remaining)
+      return c; // stray, not part of a sequence
+    codepoint = (codepoint << 6) | (c & 0x3F);
+    if (--remaining)
+      return DMD_UTF8_PENDING;
+    return (codepoint >= DMD_UTF8_PENDING) ? 0xFFFD : codepoint;
+  }
+
+  // first byte of a sequence, drops any unfinished one
+  if ((c & 0xE0) == 0xC0) {
+    codepoint = c & 0x1F;
+    remaining = 1;
+  } else if ((c & 0xF0) == 0xE0) {
+    codepoint = c & 0x0F;
+    remaining = 2;
+  } else if ((c & 0xF8) == 0xF0) {
+    codepoint = c & 0x07;
+    remaining = 3;
+  } else {
+    remaining = 0;
+    return c;
+  }
+  return DMD_UTF8_PENDING;
+}
@@ -0,0 +1,253 @@
+/*
+ DMD stream receiver
+
+ Decodes frames sent over a serial port (see DMD_StreamReceiver in DMD2.h
+ for the packet format) a byte at a time, straight into the rows of the
+ back buffer.
+
+ Copyright (C) 2014 Freetronics, Inc. (info <at> freetronics <dot> com)
+
+---
+
+ This program is free software: you can redistribute it and/or modify it under the terms
+ of the version 3 GNU General Public License as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program.
+ If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "DMD2.h"
+
+enum {
+  WAIT_SYNC1,
+  WAIT_SYNC2,
+  READ_TYPE,
+  READ_LENGTH_LOW,
+  READ_LENGTH_HIGH, // (this state and the ones after it use the back buffer)
+  READ_PAYLOAD,
+  READ_CRC_LOW,
+  READ_CRC_HIGH,
+};
+
+DMD_StreamReceiver::DMD_StreamReceiver(BaseDMD &dmd, DMDFrame &back) :
+  dmd(&dmd),
+  front(dmd),
+  back(back)
+{
+  init();
+}
+
+DMD_StreamReceiver::DMD_StreamReceiver(DMDFrame &front, DMDFrame &back) :
+  dmd(NULL),
+  front(front),
+  back(back)
+{
+  init();
+}
+
+void DMD_StreamReceiver::init()
+{
+  padding = (back.width & 7) ? 0xFF >> (back.width & 7) : 0;
+  frame_count = 0;
+  error_count = 0;
+  reset();
+}
+
+void DMD_StreamReceiver::reset()
+{
+  state = WAIT_SYNC1;
+}
+
+// True if the back buffer can't be written yet, because it's waiting to be swapped onto the display
+bool DMD_StreamReceiver::waiting()
+{
+  return state >= READ_LENGTH_HIGH && dmd && dmd->presentPending();
+}
+
+// Largest payload that makes sense for a packet type, anything longer is a false sync
+uint16_t DMD_StreamReceiver::maxLength()
+{
+  uint16_t frame_bytes = back.row_width_bytes * back.height;
+  switch(type) {
+  case DMD_STREAM_FULL:
+    return frame_bytes;
+  case DMD_STREAM_DELTA_ROWS:
+    return frame_bytes + back.height;
+  case DMD_STREAM_DELTA_RLE:
+    return frame_bytes + (frame_bytes + 127) / 128; // every run a literal one
+  default:
+    return 0;
+  }
+}
+
+size_t DMD_StreamReceiver::write(uint8_t value)
+{
+  if(waiting())
+    return 0;
+
+  switch(state) {
+  case WAIT_SYNC1:
+    if(value == DMD_STREAM_SYNC1)
+      state = WAIT_SYNC2;
+    break;
+  case WAIT_SYNC2:
+    if(value == DMD_STREAM_SYNC2)
+      state = READ_TYPE;
+    else if(value != DMD_STREAM_SYNC1)
+      state = WAIT_SYNC1;
+    break;
+  case READ_TYPE:
+    type = value;
+    crc = crcUpdate(0xFFFF, value);
+    state = READ_LENGTH_LOW;
+    break;
+  case READ_LENGTH_LOW:
+    length = value;
+    crc = crcUpdate(crc, value);
+    state = READ_LENGTH_HIGH;
+    break;
+  case READ_LENGTH_HIGH:
+    length |= value << 8;
+    crc = crcUpdate(crc, value);
+    if(length > maxLength()) {
+      // not a real packet (or its length was corrupted), look for the next one
+      error_count++;
+      state = WAIT_SYNC1;
+      break;
+    }
+    received = 0;
+    bad = (type != DMD_STREAM_FULL && type != DMD_STREAM_DELTA_ROWS && type != DMD_STREAM_DELTA_RLE)
+      || front.width != back.width || front.height != back.height;
+    run = 0;
+    startRow(0);
+    expect_row = (type == DMD_STREAM_DELTA_ROWS);
+    state = length ? READ_PAYLOAD : READ_CRC_LOW;
+    break;
+  case READ_PAYLOAD:
+    crc = crcUpdate(crc, value);
+    if(!bad)
+      payloadByte(value);
+    if(++received == length)
+      state = READ_CRC_LOW;
+    break;
+  case READ_CRC_LOW:
+    crc_low = value;
+    state = READ_CRC_HIGH;
+    break;
+  case READ_CRC_HIGH:
+    state = WAIT_SYNC1;
+    if(bad || (crc_low | (value << 8)) != crc)
+      error_count++;
+    else
+      finishPacket();
+    break;
+  }
+  return 1;
+}
+
+bool DMD_StreamReceiver::poll(Stream &stream)
+{
+  uint32_t frames = frame_count;
+  while(!waiting() && stream.available() > 0)
+    write(stream.read());
+  return frame_count != frames;
+}
+
+void DMD_StreamReceiver::startRow(uint8_t y)
+{
+  row = y;
+  col = 0;
+  if(y < back.height) {
+    back_row = back.bitmap + back.rowToBitmapIndex(y);
+    front_row = front.bitmap + front.rowToBitmapIndex(y);
+  }
+}
+
+// Write the next byte of the back buffer, either the byte of a full frame or the XOR of the front buffer
+void DMD_StreamReceiver::putPixels(uint8_t value, bool delta)
+{
+  if(row >= back.height) {
+    bad = true; // more pixels than the frame has
+    return;
+  }
+  uint8_t pixels = delta ? (front_row[col] ^ value) : (uint8_t)~value; // (bits set = off)
+  if(col == back.row_width_bytes - 1) {
+    back_row[col] = pixels | padding;
+    startRow(row + 1);
+  }
+  else {
+    back_row[col++] = pixels;
+  }
+}
+
+// Copy the rest of the front buffer up to (not including) end_row into the back buffer, unchanged
+void DMD_StreamReceiver::finishRows(uint8_t end_row)
+{
+  while(row < end_row)
+    putPixels(0, true);
+}
+
+void DMD_StreamReceiver::payloadByte(uint8_t value)
+{
+  switch(type) {
+  case DMD_STREAM_FULL:
+    putPixels(value, false);
+    break;
+
+  case DMD_STREAM_DELTA_ROWS:
+    if(expect_row) {
+      if(value < row || value >= back.height) {
+        bad = true; // rows must be in order
+        return;
+      }
+      finishRows(value);
+      expect_row = false;
+    }
+    else {
+      putPixels(value, true);
+      expect_row = (col == 0);
+    }
+    break;
+
+  case DMD_STREAM_DELTA_RLE:
+    if(!run) {
+      // start of a run
+      repeat = (value >= 0x80);
+      run = repeat ? value - 0x7E : value + 1;
+    }
+    else if(repeat) {
+      for(; run; run--)
+        putPixels(value, true);
+    }
+    else {
+      putPixels(value, true);
+      run--;
+    }
+    break;
+  }
+}
+
+void DMD_StreamReceiver::finishPacket()
+{
+  if((type == DMD_STREAM_FULL && row < back.height)
+     || (type == DMD_STREAM_DELTA_ROWS && !expect_row)
+     || (type == DMD_STREAM_DELTA_RLE && run)) {
+    error_count++; // payload ended part way through
+    return;
+  }
+  finishRows(back.height);
+
+  if(dmd) {
+    if(!dmd->presentAsync(back)) {
+      error_count++;
+      return;
+    }
+  }
+  else {
+    front.swapBuffers(back);
+  }
+  frame_count++;
+}
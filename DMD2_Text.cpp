@@ -21,112 +21,239 @@
 
 #include "DMD2.h"
 
+// Size of the data for a glyph starting at 'index' in a variable width or packed font
+static inline uint16_t glyphDataSize(const uint8_t *font, const FontHeader *header, uint16_t index, uint8_t width)
+{
+  if (header->size == DMD_PACKED_FONT)
+    return 2 + (width * pgm_read_byte(font + index + 1) + 7) / 8; // top, rows, then the bits
+  return width * ((header->height + 7) / 8);
+}
+
 void DMDFrame::selectFont(const uint8_t* font)
 {
+  if(font == this->font && glyph_offsets)
+    return; // already selected, with its offset table built
   this->font = (uint8_t *)font;
+  font_source = NULL;
+  free(glyph_offsets);
+  glyph_offsets = NULL;
+  if(!font)
+    return;
+
+  memcpy_P(&font_header, (void*)font, sizeof(FontHeader));
+  if(font_header.size == 0 || font_header.size == DMD_SPARSE_FONT)
+    return; // fixed width font, offsets are easy to calculate (sparse fonts store them)
+
+  // Build the table of glyph data offsets for a variable width font. If there isn't
+  // enough RAM, findGlyph() still works (only slower.)
+  glyph_offsets = (uint16_t *)malloc(sizeof(uint16_t) * ((font_header.charCount + DMD_GLYPH_OFFSET_STRIDE - 1) / DMD_GLYPH_OFFSET_STRIDE));
+  if(!glyph_offsets)
+    return;
+  uint16_t index = sizeof(FontHeader) + font_header.charCount;
+  for (uint8_t c = 0; c < font_header.charCount; c++) {
+    if(c % DMD_GLYPH_OFFSET_STRIDE == 0)
+      glyph_offsets[c / DMD_GLYPH_OFFSET_STRIDE] = index;
+    index += glyphDataSize(font, &font_header, index, pgm_read_byte(font + sizeof(FontHeader) + c));
+  }
+}
+
+bool DMDFrame::selectFont(DMDFontSource &source)
+{
+  selectFont((const uint8_t *)NULL);
+  if(!source.begin(font_header))
+    return false;
+  font_source = &source;
+  return true;
+}
+
+const FontHeader *DMDFrame::getFontHeader(const uint8_t *font, FontHeader &header)
+{
+  if(font == this->font)
+    return &font_header;
+  memcpy_P(&header, (void*)font, sizeof(FontHeader));
+  return &header;
 }
 
-int DMDFrame::drawChar(const int x, const int y, const char letter, DMDGraphicsMode mode, const uint8_t *font)
+bool DMDFrame::findGlyph(const uint8_t *font, const FontHeader *header, uint16_t letter, uint8_t &width, uint16_t &index)
+{
+  if (header->size == DMD_SPARSE_FONT)
+    return findSparseGlyph(font, *header, letter, width, index);
+  if (letter < header->firstChar || letter >= (header->firstChar + header->charCount))
+    return false;
+  uint8_t c = letter - header->firstChar;
+
+  if (header->size == 0) {
+    // zero length is flag indicating fixed width font (array does not contain width data entries)
+    uint8_t bytes = (header->height + 7) / 8;
+    width = header->fixedWidth;
+    index = sizeof(FontHeader) + c * bytes * width;
+    return true;
+  }
+
+  // variable width font, start from the nearest cached offset (or the first glyph)
+  // and add the widths of any glyphs in between
+  uint8_t i;
+  if (font == this->font && glyph_offsets) {
+    i = c - (c % DMD_GLYPH_OFFSET_STRIDE);
+    index = glyph_offsets[i / DMD_GLYPH_OFFSET_STRIDE];
+  } else {
+    i = 0;
+    index = sizeof(FontHeader) + header->charCount;
+  }
+  for (; i < c; i++) {
+    index += glyphDataSize(font, header, index, pgm_read_byte(font + sizeof(FontHeader) + i));
+  }
+  width = pgm_read_byte(font + sizeof(FontHeader) + c);
+  return true;
+}
+
+int DMDFrame::drawCodepoint(const int x, const int y, uint16_t letter, DMDGraphicsMode mode, const uint8_t *font)
 {
   if(!font)
     font = this->font;
   if(x >= (int)width || y >= height)
     return -1;
 
-  struct FontHeader header;
-  memcpy_P(&header, (void*)font, sizeof(FontHeader));
+  struct FontHeader scratch;
+  const FontHeader &header = *getFontHeader(font, scratch);
 
   DMDGraphicsMode invertedMode = inverseMode(mode);
 
-  char c = letter;
-  if (c == ' ') {
-    int charWide = charWidth(' ');
+  if (letter == ' ') {
+    int charWide = charWidth(' ', font);
     this->drawFilledBox(x, y, x + charWide, y + header.height, invertedMode);
     return charWide;
   }
-  uint8_t width = 0;
-  uint8_t bytes = (header.height + 7) / 8;
-  uint16_t index = 0;
+  uint8_t width;
+  uint16_t index;
+
+  if (!font) {
+    // font source, glyph data is read into RAM
+    const uint8_t *data = font_source ? font_source->glyphData(letter, width) : NULL;
+    if (!data)
+      return 0;
+    if (x >= -width && y >= -header.height)
+      drawGlyph(x, y, data, width, header.height, mode, true);
+    return width;
+  }
 
-  if (c < header.firstChar || c >= (header.firstChar + header.charCount))
+  if (!findGlyph(font, &header, letter, width, index))
     return 0;
-  c -= header.firstChar;
 
-  if (header.size == 0) {
-    // zero length is flag indicating fixed width font (array does not contain width data entries)
-    width = header.fixedWidth;
-    index = sizeof(FontHeader) + c * bytes * width;
-  } else {
-    // variable width font, read width data, to get the index
-    for (uint8_t i = 0; i < c; i++) {
-      index += pgm_read_byte(font + sizeof(FontHeader) + i);
-    }
-    index = index * bytes + header.charCount + sizeof(FontHeader);
-    width = pgm_read_byte(font + sizeof(FontHeader) + c);
-  }
   if (x < -width || y < -header.height)
     return width;
-    
-  bool inverse = false;
-  if (mode == GRAPHICS_INVERSE) {
-      inverse = true;
-  }
 
   // last but not least, draw the character
-  for (uint8_t j = 0; j < width; j++) { // Width
-    for (uint8_t i = bytes - 1; i < 254; i--) { // Vertical Bytes
-      uint8_t data = pgm_read_byte(font + index + j + (i * width));
-      int offset = (i * 8);
-      if ((i == bytes - 1) && bytes > 1) {
-        offset = header.height - 8;
-      }
-      for (uint8_t k = 0; k < 8; k++) { // Vertical bits
-        if ((offset+k >= i*8) && (offset+k <= header.height)) {
-          if (data & (1 << k)) {
-              if(inverse) {
-                setPixel(x + j, y + offset + k, GRAPHICS_OFF);
-              } else {
-                setPixel(x + j, y + offset + k, GRAPHICS_ON);
-              }
-          } else {
-              if(inverse) {
-                  setPixel(x + j, y + offset + k, GRAPHICS_ON);
-              } else {
-                  setPixel(x + j, y + offset + k, GRAPHICS_OFF);
-              }
-          }
+  if (header.size == DMD_PACKED_FONT)
+    drawPackedGlyph(x, y, font + index, width, header.height, mode);
+  else
+    drawGlyph(x, y, font + index, width, header.height, mode);
+  return width;
+}
+
+/* Glyph data is stored as columns of vertical bytes (bit 0 at the top). The columns which
+   land in the same bitmap byte (up to 8) are transposed into one byte of pixels per row, so
+   each bitmap byte is read and written once per row with the mode applied to all of its
+   pixels together. Rows and columns outside the frame are skipped without being read.
+
+   Pixels set in the glyph are drawn with 'mode', and clear pixels with inverseMode(mode),
+   so GRAPHICS_ON and GRAPHICS_INVERSE draw the whole glyph cell and the other modes only
+   change the pixels of the character itself. With no data every pixel is clear, which is
+   used for the blank columns between characters.
+*/
+void DMDFrame::drawGlyph(int x, int y, const uint8_t *data, uint8_t glyph_width, uint8_t glyph_height, DMDGraphicsMode mode, bool in_ram)
+{
+  DMDGraphicsMode set_mode = (mode == GRAPHICS_INVERSE) ? GRAPHICS_OFF : mode;
+  DMDGraphicsMode clear_mode = inverseMode(mode);
+
+  int first_col = (x < 0) ? -x : 0;
+  int end_col = glyph_width;
+  if (x + end_col > (int)width)
+    end_col = width - x;
+
+  uint8_t bytes = (glyph_height + 7) / 8;
+  for (uint8_t i = 0; i < bytes; i++) { // Vertical Bytes
+    // Last byte of a multi-byte column is aligned to the bottom of the glyph, overlapping the byte above
+    int offset = (i * 8);
+    if ((i == bytes - 1) && bytes > 1) {
+      offset = glyph_height - 8;
+    }
+    int first_bit = i * 8 - offset;
+    int last_bit = glyph_height - offset; // (single byte fonts also draw the blank row below the glyph)
+    if (!data)
+      last_bit--; // blank columns are exactly the glyph height
+    if (last_bit > 7)
+      last_bit = 7;
+    if (y + offset + first_bit < 0)
+      first_bit = -(y + offset);
+    if (y + offset + last_bit >= (int)height)
+      last_bit = height - 1 - (y + offset);
+    if (first_bit > last_bit)
+      continue;
+
+    int row_index[8];
+    for (int k = first_bit; k <= last_bit; k++)
+      row_index[k] = rowToBitmapIndex(y + offset + k);
+
+    for (int j = first_col; j < end_col; ) { // Width, a bitmap byte at a time
+      unsigned int px = x + j;
+      int group_end = j + 8 - (px & 7); // columns in the same bitmap byte as px
+      if (group_end > end_col)
+        group_end = end_col;
+
+      // Transpose the glyph columns into a byte of pixels for each row
+      uint8_t row_bits[8] = { 0 };
+      uint8_t cols = 0;
+      for (; j < group_end; j++) {
+        uint8_t bits = 0;
+        if (data)
+          bits = in_ram ? data[j + (i * glyph_width)] : pgm_read_byte(data + j + (i * glyph_width));
+        uint8_t mask = pixelToBitmask(x + j);
+        cols |= mask;
+        for (int k = first_bit; k <= last_bit; k++) {
+          if (bits & (1 << k))
+            row_bits[k] |= mask;
         }
       }
+
+      volatile uint8_t *col = bitmap + px / 8;
+      for (int k = first_bit; k <= last_bit; k++) { // Vertical bits
+        volatile uint8_t *dest = col + row_index[k];
+        *dest = glyphBitOp(set_mode, clear_mode, row_bits[k], cols).apply(*dest);
+      }
     }
   }
-  return width;
 }
 
 // Generic drawString implementation for various kinds of strings
 template <class StrType> __attribute__((always_inline)) inline void _drawString(DMDFrame *dmd, int x, int y, StrType str, DMDGraphicsMode mode, const uint8_t *font)
 {
-  struct FontHeader header;
-  memcpy_P(&header, font, sizeof(FontHeader));
+  struct FontHeader scratch;
+  const FontHeader &header = *dmd->getFontHeader(font, scratch);
 
   if (y+header.height<0)
     return;
 
-  DMDGraphicsMode invertedMode = inverseMode(mode);
   int strWidth = 0;
   if(x > 0)
-    dmd->drawLine(x-1 , y, x-1 , y + header.height - 1, invertedMode);
+    dmd->drawGlyph(x-1, y, NULL, 1, header.height, mode);
 
+  bool utf8 = (header.size == DMD_SPARSE_FONT);
+  DMD_UTF8Decoder decoder;
   char c;
   for(int idx = 0; c = str[idx], c != 0; idx++) {
-    if(c == '\n') { // Newline
+    uint16_t letter = (uint8_t)c;
+    if(utf8 && (letter = decoder.decode(c)) == DMD_UTF8_PENDING)
+      continue;
+    if(letter == '\n') { // Newline
       strWidth = 0;
       y = y - header.height - 1;
     }
     else {
-      int charWide = dmd->drawChar(x+strWidth, y, c, mode);
+      int charWide = dmd->drawCodepoint(x+strWidth, y, letter, mode, font);
       if (charWide > 0) {
         strWidth += charWide ;
-        dmd->drawLine(x + strWidth , y, x + strWidth , y + header.height-1, invertedMode);
+        dmd->drawGlyph(x + strWidth, y, NULL, 1, header.height, mode);
         strWidth++;
       } else if (charWide < 0) {
         return;
@@ -136,15 +263,34 @@ template <class StrType> __attribute__((always_inline)) inline void _drawString(
 }
 
 // Generic stringWidth implementation for various kinds of strings
- template <class StrType> __attribute__((always_inline)) inline unsigned int _stringWidth(DMDFrame *dmd, const uint8_t *, StrType str) 
+template <class StrType> __attribute__((always_inline)) inline unsigned int _stringWidth(DMDFrame *dmd, const uint8_t *font, StrType str)
 {
+  struct FontHeader scratch;
+  const FontHeader &header = *dmd->getFontHeader(font, scratch);
+
   unsigned int width = 0;
   char c;
   int idx;
-  for(idx = 0; c = str[idx], c != 0; idx++) {
-    int cwidth = dmd->charWidth(c);
-    if(cwidth > 0)
-      width += cwidth + 1;
+  if(header.size == 0) {
+    // fixed width font, every character in the font (and space) is the same width
+    unsigned int count = 0;
+    for(idx = 0; c = str[idx], c != 0; idx++) {
+      if(c == ' ' || ((uint8_t)c >= header.firstChar && (uint8_t)c < header.firstChar + header.charCount))
+        count++;
+    }
+    if(header.fixedWidth)
+      width = count * (header.fixedWidth + 1);
+  } else {
+    bool utf8 = (header.size == DMD_SPARSE_FONT);
+    DMD_UTF8Decoder decoder;
+    for(idx = 0; c = str[idx], c != 0; idx++) {
+      uint16_t letter = (uint8_t)c;
+      if(utf8 && (letter = decoder.decode(c)) == DMD_UTF8_PENDING)
+        continue;
+      uint8_t cwidth = dmd->glyphWidth(font, header, letter);
+      if(cwidth > 0)
+        width += cwidth + 1;
+    }
   }
   if(width) {
     width--;
@@ -205,29 +351,14 @@ void DMDFrame::drawString(int x, int y, const String &str, DMDGraphicsMode mode,
 //Find the width of a character
 int DMDFrame::charWidth(const char letter, const uint8_t *font)
 {
-  struct FontHeader header;
-  memcpy_P(&header, (void*)this->font, sizeof(FontHeader));
-
   if(!font)
     font = this->font;
 
-  if(letter == ' ') {
-    // if the letter is a space then return the font's fixedWidth
-    // (set as the 'width' field in New Font dialog in GLCDCreator.)
-    return header.fixedWidth;
-  }
-
-  if((uint8_t)letter < header.firstChar || (uint8_t)letter >= (header.firstChar + header.charCount)) {
-    return 0;
-  }
-
-  if(header.size == 0) {
-    // zero length is flag indicating fixed width font (array does not contain width data entries)
-    return header.fixedWidth;
-  }
+  struct FontHeader scratch;
+  const FontHeader &header = *getFontHeader(font, scratch);
 
-  // variable width font, read width data for character
-  return pgm_read_byte(this->font + sizeof(FontHeader) + letter - header.firstChar);
+  // a space is the font's fixedWidth (set as the 'width' field in New Font dialog in GLCDCreator.)
+  return glyphWidth(font, header, (uint8_t)letter);
 }
 
 unsigned int DMDFrame::stringWidth(const char *bChars, const uint8_t *font)
@@ -239,8 +370,6 @@ unsigned int DMDFrame::stringWidth(const char *bChars, const uint8_t *font)
 
 unsigned int DMDFrame::stringWidth(const String &str, const uint8_t *font)
 {
-  if(!font)
-    font = this->font;
-  return _stringWidth(this, font, str);
+  return stringWidth(str.c_str(), font);
 }
 
@@ -32,47 +32,170 @@ DMD_TextBox::DMD_TextBox(DMDFrame &dmd, int left, int top, int width, int height
   height(height),
   cur_x(0),
   cur_y(0),
-  pending_newline(false)
+  pending_newline(false),
+  decoder()
 {
 }
 
 size_t DMD_TextBox::write(uint8_t character) {
-  struct FontHeader header;
-  memcpy_P(&header, (void *)this->dmd.font, sizeof(FontHeader));
-  uint8_t rowHeight = header.height+1;
+  return write(&character, 1);
+}
+
+/* A run of characters is worked out before any of it is drawn. Anything that would be
+   scrolled out of the box by the end of the run isn't drawn at all, and the rest is drawn
+   where it ends up after all of the run's scrolling, which is done in one go. (A character
+   that ends up partly scrolled out is drawn before that, so the box may scroll twice.)
 
+   Scrolling only moves pixels inside the box, so if anything in the run would be drawn
+   outside the box (ie a character bigger than the box) it is all drawn in order instead.
+*/
+size_t DMD_TextBox::write(const uint8_t *buffer, size_t size) {
   if(width == 0)
     width = dmd.width - left;
   if(height == 0)
     height = dmd.height - top;
 
-  uint8_t char_width = dmd.charWidth(character) + 1;
-  while((cur_x > 0 && cur_x + char_width >= this->width) || pending_newline) { // Need to wrap to new line
-    if (height >= rowHeight*2) { // Can scroll
-      cur_y += rowHeight;
-      cur_x = 0;
-      if(cur_y + rowHeight > height) { // Scroll
- // int delta = cur_y + rowHeight - height; // the amount that it's over by
+  struct FontHeader scratch;
+  const FontHeader &header = *dmd.getFontHeader(dmd.font, scratch);
+  uint8_t rowHeight = header.height+1;
+  bool vertical = height >= rowHeight*2; // can scroll up a line, otherwise scrolls characters horizontally
+  bool utf8 = (header.size == DMD_SPARSE_FONT); // (a character may be split across writes)
+
+  // First pass to add up the scrolling, and check everything is drawn inside the box
+  int16_t start_x = cur_x;
+  int16_t start_y = cur_y;
+  bool start_newline = pending_newline;
+  DMD_UTF8Decoder start_decoder = decoder;
+  uint32_t total = 0;
+  bool inside = true;
+  for(size_t i = 0; i < size; i++) {
+    uint16_t character = buffer[i];
+    if(utf8 && (character = decoder.decode(buffer[i])) == DMD_UTF8_PENDING)
+      continue;
+    uint8_t char_width = dmd.glyphWidth(dmd.font, header, character) + 1;
+    total += wrap(char_width, rowHeight);
+    inside = inside && drawsInside(character, char_width, rowHeight);
+    cur_x += char_width;
+    if(character == '\n')
+      pending_newline = true;
+  }
+  cur_x = start_x;
+  cur_y = start_y;
+  pending_newline = start_newline;
+  decoder = start_decoder;
+
+  uint32_t done = 0; // scrolling up to the current character
+  uint32_t applied = 0; // scrolling actually done so far
+  for(size_t i = 0; i < size; i++) {
+    uint16_t character = buffer[i];
+    if(utf8 && (character = decoder.decode(buffer[i])) == DMD_UTF8_PENDING)
+      continue;
+    uint8_t char_width = dmd.glyphWidth(dmd.font, header, character) + 1;
+    done += wrap(char_width, rowHeight);
+
+    // Where this character is now and how far the rest of the run scrolls it
+    int32_t pos = vertical ? cur_y : cur_x;
+    int32_t later = total - done;
+    int cell;
+    if(vertical)
+      cell = rowHeight;
+    else if(character == '\n')
+      cell = width - cur_x;
+    else
+      cell = (character == ' ') ? char_width : char_width - 1; // spaces also fill the gap after them
+
+    bool draw = true;
+    uint32_t scroll_to = done;
+    if(inside) {
+      if(pos >= later) // ends up all inside the box
+        scroll_to = total;
+      else if(pos + cell <= later) // scrolled out by the end of the run
+        draw = false;
+      // (otherwise it ends up partly scrolled out)
+    }
+
+    if(draw) {
+      if(applied < scroll_to) {
+        scrollBox(scroll_to - applied, vertical);
+        applied = scroll_to;
       }
-    } else if(pending_newline) { // No room, so just clear display
-      clear();
-    } else { // Scroll characters horizontally
-      int scroll_by = char_width - (this->width - cur_x - 1);
-      scrollX(-scroll_by);
+      int shift = applied - done;
+      if(vertical)
+        drawAt(character, cur_x, cur_y - shift, rowHeight);
+      else
+        drawAt(character, cur_x - shift, cur_y, rowHeight);
+    }
+
+    if(character == '\n')
+      pending_newline = true;
+    cur_x += char_width;
+  }
+  if(applied < total)
+    scrollBox(total - applied, vertical);
+  return size;
+}
+
+/* Move the cursor to a new line (or make room on this one) if the next character needs it,
+   and return how far the box needs to scroll up (or left, if it's only one line high)
+   before the character is drawn. Clearing the box counts as scrolling all the way. */
+int DMD_TextBox::wrap(uint8_t char_width, uint8_t row_height) {
+  if(!pending_newline && (cur_x == 0 || cur_x + char_width < this->width))
+    return 0;
+
+  bool newline = pending_newline;
+  pending_newline = false;
+  if (height >= row_height*2) { // Can scroll
+    cur_y += row_height;
+    cur_x = 0;
+    if(cur_y + row_height > height) { // Scroll up by a line to make room
+      cur_y -= row_height;
+      return row_height;
     }
-    pending_newline = false;
+    return 0;
+  }
+  if(newline) { // No room, so just clear display
+    reset();
+    return width;
   }
+  // Scroll characters horizontally
+  int scroll_by = char_width - (this->width - cur_x - 1);
+  cur_x -= scroll_by;
+  while(cur_x < 0)
+    cur_x += width;
+  return scroll_by;
+}
 
-  if(character == '\n') {
-    pending_newline = true;
+// Whether drawing a character at the cursor only changes pixels inside the box
+bool DMD_TextBox::drawsInside(uint16_t character, uint8_t char_width, uint8_t row_height) {
+  if(cur_x < 0 || cur_y < 0 || cur_y + row_height > height)
+    return false;
+  int cell_width = (character == ' ') ? char_width : char_width - 1;
+  return character == '\n' || cur_x + cell_width <= width;
+}
+
+// Draw a character at x,y in the box
+void DMD_TextBox::drawAt(uint16_t character, int x, int y, uint8_t row_height) {
+  if(character == '\n' && x < width && y < height) {
     // clear the rest of the line after the current cursor position,
     // this allows you to then use reset() and do a flicker-free redraw
-    dmd.drawFilledBox(cur_x+left,cur_y+top,left+width,cur_y+top+rowHeight, inverted ? GRAPHICS_ON : GRAPHICS_OFF);
+    int bottom = (y + row_height < height) ? y + row_height : height;
+    dmd.drawFilledBox(x+left,y+top,left+width-1,top+bottom-1, inverted ? GRAPHICS_ON : GRAPHICS_OFF);
   }
+  dmd.drawCodepoint(x+left,y+top,character, inverted ? GRAPHICS_INVERSE : GRAPHICS_ON);
+}
 
-  dmd.drawChar(cur_x+left,cur_y+top,character, inverted ? GRAPHICS_OFF : GRAPHICS_ON);
-  cur_x += char_width;
-  return 1;
+// Scroll the box contents up (or left) without moving the cursor
+void DMD_TextBox::scrollBox(uint32_t scrollBy, bool vertical) {
+  int16_t x = cur_x;
+  int16_t y = cur_y;
+  int extent = vertical ? height : width;
+  int by = (scrollBy > (uint32_t)extent) ? extent : scrollBy;
+  if(vertical)
+    scrollY(-by);
+  else
+    scrollX(-by);
+  cur_x = x;
+  cur_y = y;
 }
 
 void DMD_TextBox::scrollY(int scrollBy) {
@@ -82,9 +205,12 @@ void DMD_TextBox::scrollY(int scrollBy) {
   }
   else if(scrollBy < 0) { // Scroll up
     dmd.movePixels(left, top - scrollBy, left, top, width, height + scrollBy);
+    // movePixels() only turns off the uncovered part of the source area, so clear all the new line(s)
+    dmd.drawFilledBox(left, top+height+scrollBy, left+width-1, top+height-1, inverted ? GRAPHICS_ON : GRAPHICS_OFF);
   }
   else if(scrollBy > 0) { // Scroll down
     dmd.movePixels(left, top, left, top + scrollBy, width, height - scrollBy);
+    dmd.drawFilledBox(left, top, left+width-1, top+scrollBy-1, inverted ? GRAPHICS_ON : GRAPHICS_OFF);
   }
 
   cur_y += scrollBy;
@@ -102,9 +228,11 @@ void DMD_TextBox::scrollX(int scrollBy) {
   }
   else if(scrollBy < 0) { // Scroll left
     dmd.movePixels(left-scrollBy, top, left, top, width + scrollBy, height);
+    dmd.drawFilledBox(left+width+scrollBy, top, left+width-1, top+height-1, inverted ? GRAPHICS_ON : GRAPHICS_OFF);
   }
-  else { // Scroll right
+  else if(scrollBy > 0) { // Scroll right
     dmd.movePixels(left, top, left+scrollBy, top, width - scrollBy, height);
+    dmd.drawFilledBox(left, top, left+scrollBy-1, top+height-1, inverted ? GRAPHICS_ON : GRAPHICS_OFF);
   }
 
   cur_x += scrollBy;
@@ -117,7 +245,7 @@ void DMD_TextBox::scrollX(int scrollBy) {
 void DMD_TextBox::clear() {
   this->reset();
 
-  dmd.drawFilledBox(left,top,left+width,top+height,inverted ? GRAPHICS_ON : GRAPHICS_OFF);
+  dmd.drawFilledBox(left,top,left+width-1,top+height-1,inverted ? GRAPHICS_ON : GRAPHICS_OFF);
 }
 
 void DMD_TextBox::reset() {
@@ -0,0 +1,242 @@
+/*
+ DMD TextLayout implementation
+
+ Word wraps and aligns text into a box on the display.
+
+ Copyright (C) 2014 Freetronics, Inc. (info <at> freetronics <dot> com)
+
+---
+
+ This program is free software: you can redistribute it and/or modify it under the terms
+ of the version 3 GNU General Public License as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program.
+ If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "DMD2.h"
+
+// Width of a run of characters after adding one more, with the usual 1 pixel gap in between
+static inline unsigned int addWidth(unsigned int width, uint8_t char_width)
+{
+  return width ? width + 1 + char_width : char_width;
+}
+
+DMD_TextLayout::DMD_TextLayout(DMDFrame &dmd, int left, int top, int width, int height) :
+  dmd(dmd),
+  left(left),
+  top(top),
+  width(width),
+  height(height),
+  align(ALIGN_LEFT),
+  text(0),
+  font(0),
+  line_count(0),
+  laid_out_text(0),
+  laid_out_size(0),
+  laid_out_align(ALIGN_LEFT)
+{
+}
+
+DMD_TextLayout::~DMD_TextLayout()
+{
+  free(laid_out_text);
+}
+
+uint8_t DMD_TextLayout::layout(const char *text, const uint8_t *font)
+{
+  if(width == 0)
+    width = dmd.width - left;
+  if(height == 0)
+    height = dmd.height - top;
+  if(!font)
+    font = dmd.getFont();
+  this->text = text;
+  if(!font || !text) {
+    this->font = NULL;
+    line_count = 0;
+    return 0;
+  }
+
+  if(font == this->font && align == laid_out_align && laid_out_text && !strcmp(text, laid_out_text))
+    return line_count; // same text as last time, the runs are still good
+  uint16_t length = strlen(text);
+  if(length >= laid_out_size) {
+    free(laid_out_text);
+    laid_out_text = (char *)malloc(length + 1);
+    laid_out_size = laid_out_text ? length + 1 : 0;
+  }
+  if(laid_out_text)
+    memcpy(laid_out_text, text, length + 1);
+  this->font = font;
+  laid_out_align = align;
+  FontHeader scratch;
+  header = *dmd.getFontHeader(font, scratch);
+  line_count = 0;
+
+  uint16_t line_start = 0;
+  unsigned int line_width = 0;
+  bool wrapped = false; // current line follows a wrap, so leading spaces are dropped
+  bool can_break = false; // there's a space on this line to break at...
+  uint16_t break_end = 0; // ...which is where the line ends if it's broken there...
+  unsigned int break_width = 0; // ...and the line's width if it is
+  uint16_t word_start = 0; // first character of the current word...
+  unsigned int word_width = 0; // ...and the width of the word so far
+  bool prev_space = false;
+  bool utf8 = (header.size == DMD_SPARSE_FONT);
+  DMD_UTF8Decoder decoder;
+  uint16_t char_start = 0; // first byte of the current character (several in UTF-8)
+
+  for(uint16_t i = 0; i <= length; i++) {
+    char c = text[i];
+    if(c == 0 || c == '\n') {
+      decoder.reset();
+      if(c == 0 && i == line_start)
+        break; // nothing left over
+      bool added;
+      if(prev_space && can_break) // leave out trailing spaces
+        added = addRun(line_start, break_end, break_width);
+      else
+        added = addRun(line_start, i, line_width);
+      if(!added)
+        break;
+      line_start = word_start = i + 1;
+      line_width = word_width = 0;
+      wrapped = can_break = prev_space = false;
+      continue;
+    }
+
+    if(!decoder.pending())
+      char_start = i;
+    uint16_t letter = (uint8_t)c;
+    if(utf8 && (letter = decoder.decode(c)) == DMD_UTF8_PENDING)
+      continue;
+    uint8_t w = DMDFrame::fontCharWidth(font, header, letter);
+    if(!w)
+      continue;
+
+    if(c == ' ') {
+      if(line_width == 0 && wrapped) {
+        line_start = word_start = i + 1;
+        continue;
+      }
+      if(!prev_space && line_width) {
+        can_break = true;
+        break_end = i;
+        break_width = line_width;
+      }
+      line_width = addWidth(line_width, w);
+      word_start = i + 1;
+      word_width = 0;
+      prev_space = true;
+      if(line_width > (unsigned int)width && can_break) {
+        // spaces don't fit, wrap here and start the next line with the next word
+        if(!addRun(line_start, break_end, break_width))
+          break;
+        line_start = i + 1;
+        line_width = 0;
+        wrapped = true;
+        can_break = false;
+      }
+      continue;
+    }
+
+    while(addWidth(line_width, w) > (unsigned int)width && line_width) {
+      if(can_break) {
+        // wrap at the last space, the current word moves to the next line
+        if(!addRun(line_start, break_end, break_width))
+          return line_count;
+        line_start = word_start;
+        line_width = word_width;
+      } else {
+        // word is wider than the box, break it here
+        if(!addRun(line_start, char_start, line_width))
+          return line_count;
+        line_start = word_start = char_start;
+        line_width = word_width = 0;
+      }
+      wrapped = true;
+      can_break = false;
+    }
+    line_width = addWidth(line_width, w);
+    word_width = addWidth(word_width, w);
+    prev_space = false;
+  }
+  return line_count;
+}
+
+// Add a run for the next line, aligned in the box. Returns false if the line doesn't fit.
+bool DMD_TextLayout::addRun(uint16_t start, uint16_t end, unsigned int line_width)
+{
+  int y = line_count * (header.height + 1);
+  if(line_count == DMD_LAYOUT_MAX_LINES || (line_count && y + header.height > height))
+    return false;
+  DMDTextRun &run = runs[line_count++];
+  run.start = start;
+  run.end = end;
+  run.y = y;
+  switch(align) {
+  case ALIGN_CENTER:
+    run.x = ((int)width - (int)line_width) / 2;
+    break;
+  case ALIGN_RIGHT:
+    run.x = (int)width - (int)line_width;
+    break;
+  default:
+    run.x = 0;
+  }
+  return true;
+}
+
+void DMD_TextLayout::draw(DMDGraphicsMode mode, bool clearBox)
+{
+  if(!text || !font)
+    return;
+  if(clearBox && (mode == GRAPHICS_ON || mode == GRAPHICS_INVERSE)) {
+    // Clip the box to the frame
+    int x = left, w = width;
+    if(x < 0) {
+      w += x;
+      x = 0;
+    }
+    if(x + w > (int)dmd.width)
+      w = dmd.width - x;
+    for(int y = top < 0 ? 0 : top; w > 0 && y < top + height && y < (int)dmd.height; y++)
+      DMDFrame::fillRowBits(dmd.bitmap + dmd.rowToBitmapIndex(y), x, w, mode == GRAPHICS_INVERSE);
+  }
+
+  for(uint8_t line = 0; line < line_count; line++) {
+    const DMDTextRun &run = runs[line];
+    int x = left + run.x;
+    int y = top + run.y;
+    bool first = true;
+    DMD_UTF8Decoder decoder;
+    for(uint16_t i = run.start; i < run.end; i++) {
+      uint16_t letter = (uint8_t)text[i];
+      if(header.size == DMD_SPARSE_FONT && (letter = decoder.decode(text[i])) == DMD_UTF8_PENDING)
+        continue;
+      uint8_t w;
+      uint16_t index;
+      const uint8_t *data = NULL;
+      if(letter == ' ')
+        w = header.fixedWidth;
+      else if(dmd.findGlyph(font, &header, letter, w, index) && w)
+        data = font + index;
+      else
+        continue;
+      if(!first) {
+        dmd.drawGlyph(x, y, NULL, 1, header.height, mode);
+        x++;
+      }
+      if(data && header.size == DMD_PACKED_FONT)
+        dmd.drawPackedGlyph(x, y, data, w, header.height, mode);
+      else
+        dmd.drawGlyph(x, y, data, w, header.height, mode);
+      x += w;
+      first = false;
+    }
+  }
+}
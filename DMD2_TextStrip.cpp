@@ -0,0 +1,254 @@
+/*
+ DMD TextStrip implementation
+
+ Renders a message of any length into a bit-per-pixel strip once, so it
+ can be scrolled through a region of the display without redrawing the
+ text on every step.
+
+ Copyright (C) 2014 Freetronics, Inc. (info <at> freetronics <dot> com)
+
+---
+
+ This program is free software: you can redistribute it and/or modify it under the terms
+ of the version 3 GNU General Public License as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program.
+ If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "DMD2.h"
+
+// In lazy mode, columns rendered beyond the width of the region each time a chunk is rendered
+const uint16_t LAZY_CHUNK_EXTRA = 64;
+
+DMD_TextStrip::DMD_TextStrip(DMDFrame &dmd, int left, int top, int width, int height) :
+  dmd(dmd),
+  left(left),
+  top(top),
+  width(width),
+  height(height),
+  text(0),
+  text_flash(false),
+  font(0),
+  text_width(0),
+  offset(0),
+  strip(0),
+  strip_stride(0),
+  lazy(false),
+  chunk_x(0),
+  chunk_width(0),
+  chunk_char(0),
+  chunk_char_x(0)
+{
+}
+
+DMD_TextStrip::~DMD_TextStrip()
+{
+  free(strip);
+}
+
+bool DMD_TextStrip::setText(const char *text, bool lazy)
+{
+  return begin(text, false, lazy);
+}
+
+#if defined(__AVR__) || defined(ESP8266)
+bool DMD_TextStrip::setText_P(const char *flashStr, bool lazy)
+{
+  return begin(flashStr, true, lazy);
+}
+#endif
+
+bool DMD_TextStrip::begin(const char *text, bool flash, bool lazy)
+{
+  if(width == 0)
+    width = dmd.width - left;
+  if(height == 0)
+    height = dmd.height - top;
+
+  free(strip);
+  strip = NULL;
+  this->text = text;
+  this->text_flash = flash;
+  this->lazy = lazy;
+  font = dmd.getFont();
+  if(!font)
+    return false;
+  memcpy_P(&header, (void*)font, sizeof(FontHeader));
+
+  // Measure the text, same spacing as drawString()
+  text_width = 0;
+  DMD_UTF8Decoder decoder;
+  char c;
+  uint16_t index;
+  for(uint16_t idx = 0; c = charAt(idx), c != 0; idx++) {
+    uint16_t letter = (uint8_t)c;
+    if(header.size == DMD_SPARSE_FONT && (letter = decoder.decode(c)) == DMD_UTF8_PENDING)
+      continue;
+    uint8_t w = glyphWidth(letter, index);
+    if(w)
+      text_width += w + 1;
+  }
+  if(text_width)
+    text_width--;
+  offset = -width; // start with the text just off the right edge
+
+  if(!lazy && text_width > 0xFFF0)
+    return false; // too long to render in one go
+  chunk_width = lazy ? (width + LAZY_CHUNK_EXTRA + 7) & ~7 : text_width;
+  strip_stride = (chunk_width + 7) / 8;
+  if(strip_stride) {
+    strip = (uint8_t *)malloc(strip_stride * header.height);
+    if(!strip)
+      return false;
+  }
+  chunk_char = 0;
+  chunk_char_x = 0;
+  renderChunk(0);
+  return true;
+}
+
+// Width of a character, as drawn by drawChar(). index is the glyph data offset, or 0 for blank
+uint8_t DMD_TextStrip::glyphWidth(uint16_t letter, uint16_t &index)
+{
+  index = 0;
+  if(letter == ' ')
+    return header.fixedWidth;
+  uint8_t width;
+  if(!dmd.findGlyph(font, &header, letter, width, index))
+    return 0;
+  return width;
+}
+
+// Render the characters overlapping strip columns from_x onwards into the strip buffer
+void DMD_TextStrip::renderChunk(long from_x)
+{
+  if(!strip)
+    return;
+  chunk_x = from_x;
+  memset(strip, 0xFF, strip_stride * header.height);
+
+  // Walk forward from the first character of the last chunk if we can, otherwise from the start
+  uint16_t idx = chunk_char;
+  long x = chunk_char_x;
+  if(x > from_x) {
+    idx = 0;
+    x = 0;
+  }
+  bool found_first = false;
+  uint8_t bytes = (header.height + 7) / 8;
+  DMD_UTF8Decoder decoder;
+  uint16_t char_start = idx; // first byte of the current character (several in UTF-8)
+  char c;
+  for(; c = charAt(idx), c != 0 && x < chunk_x + chunk_width; idx++) {
+    if(!decoder.pending())
+      char_start = idx;
+    uint16_t letter = (uint8_t)c;
+    if(header.size == DMD_SPARSE_FONT && (letter = decoder.decode(c)) == DMD_UTF8_PENDING)
+      continue;
+    uint16_t index;
+    uint8_t w = glyphWidth(letter, index);
+    if(!w)
+      continue;
+    if(x + w <= chunk_x) {
+      x += w + 1;
+      continue;
+    }
+    if(!found_first) {
+      chunk_char = char_start;
+      chunk_char_x = x;
+      found_first = true;
+    }
+    if(index) {
+      const uint8_t *data = font + index;
+      for(uint8_t j = 0; j < w; j++) {
+        long col = x + j - chunk_x;
+        if(col < 0 || col >= chunk_width)
+          continue;
+        uint8_t *dest = strip + col / 8;
+        uint8_t mask = ~(0x80 >> (col & 7));
+        if(header.size == DMD_PACKED_FONT) {
+          uint32_t bits = DMDFrame::packedColumn(data, j);
+          for(uint8_t row = 0; bits && row < header.height; row++, bits >>= 1) {
+            if(bits & 1)
+              dest[row * strip_stride] &= mask;
+          }
+          continue;
+        }
+        for(uint8_t i = 0; i < bytes; i++) {
+          // Same byte layout as DMDFrame::drawGlyph()
+          uint8_t byte_top = (i == bytes - 1 && bytes > 1) ? header.height - 8 : i * 8;
+          uint8_t bits = pgm_read_byte(data + j + i * w) >> (i * 8 - byte_top);
+          for(uint8_t row = i * 8; bits && row < header.height; row++, bits >>= 1) {
+            if(bits & 1)
+              dest[row * strip_stride] &= mask; // bits clear = on
+          }
+        }
+      }
+    }
+    x += w + 1;
+  }
+}
+
+void DMD_TextStrip::draw()
+{
+  // Clip the region to the frame. Columns hidden off the left edge move the first
+  // visible column further along the strip, rows hidden off the top are skipped.
+  int skip_x = left < 0 ? -left : 0;
+  int skip_y = top < 0 ? -top : 0;
+  int w = width;
+  if(left + w > (int)dmd.width)
+    w = dmd.width - left;
+  w -= skip_x;
+  int rows = height;
+  if(top + rows > (int)dmd.height)
+    rows = dmd.height - top;
+  if(w <= 0 || rows <= skip_y)
+    return;
+  int x = left + skip_x;
+  long view = offset + skip_x; // strip column shown at x
+
+  // Columns of the window that show the text, the rest are blank
+  long text_start = view < 0 ? 0 : view;
+  long text_end = view + w;
+  if(text_end > (long)text_width)
+    text_end = text_width;
+  if(!strip)
+    text_end = text_start;
+
+  if(lazy && text_start < text_end && (text_start < chunk_x || text_end > chunk_x + chunk_width))
+    renderChunk(text_start & ~7L);
+
+  for(int y = skip_y; y < rows; y++) {
+    volatile uint8_t *dest = dmd.bitmap + dmd.rowToBitmapIndex(top + y);
+    if(text_start >= text_end || y >= header.height) {
+      DMDFrame::fillRowBits(dest, x, w, false);
+      continue;
+    }
+    unsigned int before = text_start - view;
+    unsigned int after = view + w - text_end;
+    if(before)
+      DMDFrame::fillRowBits(dest, x, before, false);
+    DMDFrame::copyRowBits(dest, x + before, strip + y * strip_stride, text_start - chunk_x, text_end - text_start);
+    if(after)
+      DMDFrame::fillRowBits(dest, x + w - after, after, false);
+  }
+}
+
+void DMD_TextStrip::scroll(int scrollBy)
+{
+  if(width == 0)
+    width = dmd.width - left;
+  long period = text_width + width;
+  if(period <= 0)
+    return;
+  offset += scrollBy % period;
+  if(offset >= (long)text_width)
+    offset -= period;
+  else if(offset < -width)
+    offset += period;
+  draw();
+}
@@ -0,0 +1,213 @@
+/*
+ DMD Ticker implementation
+
+ Scrolls a stream of text across part of the display, rendering each
+ column of text from the font just as it's needed.
+
+ Copyright (C) 2014 Freetronics, Inc. (info <at> freetronics <dot> com)
+
+---
+
+ This program is free software: you can redistribute it and/or modify it under the terms
+ of the version 3 GNU General Public License as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program.
+ If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "DMD2.h"
+
+DMD_Ticker::DMD_Ticker(DMDFrame &dmd, int left, int top, int width, int height) :
+  dmd(dmd),
+  left(left),
+  top(top),
+  width(width),
+  height(height),
+  queue_head(0),
+  queue_len(0),
+  ring(0),
+  ring_stride(0),
+  ring_head(0),
+  hidden_rows(0),
+  glyph_data(0),
+  glyph_width(0),
+  glyph_col(1),
+  speed(0),
+  last_update(0),
+  carry(0)
+{
+}
+
+DMD_Ticker::~DMD_Ticker()
+{
+  free(ring);
+}
+
+size_t DMD_Ticker::write(uint8_t character)
+{
+  if(queue_len == DMD_TICKER_QUEUE)
+    return 0;
+  queue[(queue_head + queue_len) % DMD_TICKER_QUEUE] = character;
+  queue_len++;
+  return 1;
+}
+
+// Allocate the ring of columns the first time it's needed (the frame may not
+// be set up yet when the ticker is constructed)
+bool DMD_Ticker::begin()
+{
+  if(ring)
+    return true;
+  // Clip the region to the frame. Columns off the left edge are dropped (text scrolls out of
+  // sight at the frame's edge instead), rows off the top are glyph rows that aren't drawn.
+  int x = left, y = top;
+  int w = width ? width : dmd.width - left;
+  int h = height ? height : dmd.height - top;
+  int hidden = 0;
+  if(x < 0) {
+    w += x;
+    x = 0;
+  }
+  if(y < 0) {
+    hidden = -y;
+    h += y;
+    y = 0;
+  }
+  if(x + w > (int)dmd.width)
+    w = dmd.width - x;
+  if(y + h > (int)dmd.height)
+    h = dmd.height - y;
+  if(w <= 0 || h <= 0)
+    return false;
+  ring_stride = (w + 7) / 8;
+  ring = (uint8_t *)malloc(ring_stride * h);
+  if(!ring)
+    return false;
+  left = x;
+  top = y;
+  width = w;
+  height = h;
+  hidden_rows = hidden;
+  memset(ring, 0xFF, ring_stride * height);
+  ring_head = 0;
+  return true;
+}
+
+void DMD_Ticker::clear()
+{
+  queue_len = 0;
+  decoder.reset();
+  glyph_data = NULL;
+  glyph_width = 0;
+  glyph_col = 1;
+  if(!begin())
+    return;
+  memset(ring, 0xFF, ring_stride * height);
+  for(int y = 0; y < height; y++)
+    DMDFrame::fillRowBits(dmd.bitmap + dmd.rowToBitmapIndex(top + y), left, width, false);
+}
+
+// Take the next character with something to draw off the queue, using the frame's
+// currently selected font. Leaves a single blank column if the queue is empty.
+void DMD_Ticker::nextGlyph()
+{
+  glyph_data = NULL;
+  glyph_width = 0;
+  glyph_col = 0;
+  const uint8_t *font = dmd.getFont();
+  while(queue_len && font) {
+    char c = queue[queue_head];
+    queue_head = (queue_head + 1) % DMD_TICKER_QUEUE;
+    queue_len--;
+    FontHeader scratch;
+    header = *dmd.getFontHeader(font, scratch);
+    uint16_t letter = (uint8_t)c;
+    if(header.size == DMD_SPARSE_FONT && (letter = decoder.decode(c)) == DMD_UTF8_PENDING)
+      continue;
+    if(letter == ' ' || letter == '\n') {
+      glyph_width = header.fixedWidth;
+      return;
+    }
+    uint8_t w;
+    uint16_t index;
+    if(dmd.findGlyph(font, &header, letter, w, index) && w) {
+      glyph_data = font + index;
+      glyph_width = w;
+      return;
+    }
+  }
+}
+
+// Render column glyph_col of the current glyph into column 'col' of the ring
+void DMD_Ticker::renderColumn(uint16_t col)
+{
+  uint8_t *dest = ring + col / 8;
+  uint8_t mask = 0x80 >> (col & 7);
+  for(int row = 0; row < height; row++)
+    dest[row * ring_stride] |= mask; // bits set = off
+  if(!glyph_data || glyph_col >= glyph_width)
+    return;
+
+  if(header.size == DMD_PACKED_FONT) {
+    uint32_t bits = DMDFrame::packedColumn(glyph_data, glyph_col);
+    for(int row = 0; bits && row < header.height && row < height; row++, bits >>= 1) {
+      if(bits & 1)
+        dest[row * ring_stride] &= ~mask;
+    }
+    return;
+  }
+
+  uint8_t bytes = (header.height + 7) / 8;
+  for(uint8_t i = 0; i < bytes; i++) {
+    // Same byte layout as DMDFrame::drawGlyph()
+    uint8_t byte_top = (i == bytes - 1 && bytes > 1) ? header.height - 8 : i * 8;
+    uint8_t bits = pgm_read_byte(glyph_data + glyph_col + i * glyph_width) >> (i * 8 - byte_top);
+    for(int row = i * 8; bits && row < header.height && row - hidden_rows < height; row++, bits >>= 1) {
+      if((bits & 1) && row >= hidden_rows)
+        dest[(row - hidden_rows) * ring_stride] &= ~mask;
+    }
+  }
+}
+
+void DMD_Ticker::step(unsigned int columns)
+{
+  if(!begin())
+    return;
+  while(columns--) {
+    if(glyph_col > glyph_width)
+      nextGlyph();
+    // The leftmost column scrolls off, and its place in the ring becomes the new rightmost column
+    renderColumn(ring_head);
+    glyph_col++;
+    if(++ring_head == width)
+      ring_head = 0;
+  }
+
+  for(int y = 0; y < height; y++) {
+    volatile uint8_t *dest = dmd.bitmap + dmd.rowToBitmapIndex(top + y);
+    const uint8_t *src = ring + y * ring_stride;
+    DMDFrame::copyRowBits(dest, left, src, ring_head, width - ring_head);
+    if(ring_head)
+      DMDFrame::copyRowBits(dest, left + width - ring_head, src, 0, ring_head);
+  }
+}
+
+bool DMD_Ticker::update()
+{
+  unsigned long now = millis();
+  unsigned long elapsed = now - last_update;
+  last_update = now;
+  if(!speed)
+    return false;
+  if(elapsed > 1000)
+    elapsed = 1000; // don't try to catch up on more than a second
+  unsigned long due = elapsed * speed + carry;
+  carry = due % 1000;
+  if(due < 1000)
+    return false;
+  step(due / 1000);
+  return true;
+}
@@ -0,0 +1,326 @@
+/*
+ DMD timeline implementation
+
+ Steps animation tracks when they're due, from a clock passed to tick()
+ rather than by waiting in delay().
+
+ Copyright (C) 2014 Freetronics, Inc. (info <at> freetronics <dot> com)
+
+---
+
+ This program is free software: you can redistribute it and/or modify it under the terms
+ of the version 3 GNU General Public License as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program.
+ If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "DMD2.h"
+
+const uint8_t MAX_ROW_BYTES = 32; // frames are at most 255 pixels wide
+
+static inline uint16_t saturate16(unsigned long value)
+{
+  return value > 0xFFFF ? 0xFFFF : value;
+}
+
+// Distance to scroll for 'steps' steps of 'per_step' pixels, across an area 'size' pixels wide
+static int scrollDistance(int per_step, unsigned long steps, uint8_t size, bool wrap)
+{
+  if(!per_step || !steps || !size)
+    return 0;
+  unsigned int magnitude = abs(per_step);
+  unsigned int distance;
+  if(wrap)
+    distance = (magnitude % size) * (steps % size) % size;
+  else if(steps >= size || steps * magnitude >= size)
+    distance = size; // everything scrolls off
+  else
+    distance = steps * magnitude;
+  return (per_step < 0) ? -(int)distance : (int)distance;
+}
+
+static uint8_t gcd(uint8_t a, uint8_t b)
+{
+  while(b) {
+    uint8_t r = a % b;
+    a = b;
+    b = r;
+  }
+  return a;
+}
+
+DMD_Timeline::DMD_Timeline(DMDFrame &frame, BaseDMD *dmd) :
+  frame(frame),
+  dmd(dmd)
+{
+  for(uint8_t i = 0; i < DMD_TIMELINE_TRACKS; i++)
+    tracks[i].kind = TRACK_NONE;
+}
+
+DMD_Timeline::Track *DMD_Timeline::track(int track)
+{
+  if(track < 0 || track >= DMD_TIMELINE_TRACKS || tracks[track].kind == TRACK_NONE)
+    return NULL;
+  return &tracks[track];
+}
+
+// Fill in the first free track, returns its number or -1 if there isn't one
+int DMD_Timeline::add(uint8_t kind, unsigned long period, void *target)
+{
+  for(uint8_t i = 0; i < DMD_TIMELINE_TRACKS; i++) {
+    Track &t = tracks[i];
+    if(t.kind != TRACK_NONE)
+      continue;
+    memset(&t, 0, sizeof(Track));
+    t.kind = kind;
+    t.period = period;
+    t.target = target;
+    return i;
+  }
+  return -1;
+}
+
+int DMD_Timeline::addFunction(unsigned long period, DMDTrackFunction function, void *context)
+{
+  int res = add(TRACK_FUNCTION, period, context);
+  if(res >= 0)
+    tracks[res].function = function;
+  return res;
+}
+
+int DMD_Timeline::addScroll(unsigned long period, int dx, int dy, bool wrap,
+                            unsigned int left, unsigned int top, unsigned int width, unsigned int height)
+{
+  if(left >= frame.width || top >= frame.height)
+    return -1;
+  int res = add(TRACK_SCROLL, period, NULL);
+  if(res < 0)
+    return res;
+  Track &t = tracks[res];
+  t.left = left;
+  t.top = top;
+  t.width = (width == 0 || left + width > frame.width) ? frame.width - left : width;
+  t.height = (height == 0 || top + height > frame.height) ? frame.height - top : height;
+  t.dx = (dx > 127) ? 127 : (dx < -127) ? -127 : dx;
+  t.dy = (dy > 127) ? 127 : (dy < -127) ? -127 : dy;
+  t.count = wrap;
+  return res;
+}
+
+int DMD_Timeline::addBlink(unsigned long period, DMDFrame &element, unsigned int left, unsigned int top)
+{
+  if(left >= frame.width || top >= frame.height)
+    return -1;
+  int res = add(TRACK_BLINK, period, &element);
+  if(res < 0)
+    return res;
+  Track &t = tracks[res];
+  t.left = left;
+  t.top = top;
+  t.width = (left + element.width > frame.width) ? frame.width - left : element.width;
+  t.height = (top + element.height > frame.height) ? frame.height - top : element.height;
+  t.position = 1; // starts off shown
+  return res;
+}
+
+int DMD_Timeline::addFrames(unsigned long period, DMDFrame **frames, uint8_t count, unsigned int left, unsigned int top)
+{
+  if(!count || left >= frame.width || top >= frame.height)
+    return -1;
+  int res = add(TRACK_FRAMES, period, frames);
+  if(res < 0)
+    return res;
+  Track &t = tracks[res];
+  t.left = left;
+  t.top = top;
+  t.count = count;
+  return res;
+}
+
+int DMD_Timeline::addTicker(unsigned long period, DMD_Ticker &ticker, unsigned int columns)
+{
+  int res = add(TRACK_TICKER, period, &ticker);
+  if(res >= 0)
+    tracks[res].count = (columns > 255) ? 255 : columns;
+  return res;
+}
+
+void DMD_Timeline::remove(int track)
+{
+  Track *t = this->track(track);
+  if(t)
+    t->kind = TRACK_NONE;
+}
+
+void DMD_Timeline::setPeriod(int track, unsigned long period)
+{
+  Track *t = this->track(track);
+  if(!t)
+    return;
+  if(!t->period)
+    t->started = false; // unpaused, start again from the next tick
+  t->period = period;
+}
+
+uint16_t DMD_Timeline::getLateness(int track)
+{
+  Track *t = this->track(track);
+  return t ? t->lateness : 0;
+}
+
+uint16_t DMD_Timeline::getMaxLateness(int track)
+{
+  Track *t = this->track(track);
+  return t ? t->max_lateness : 0;
+}
+
+uint16_t DMD_Timeline::getSkippedSteps(int track)
+{
+  Track *t = this->track(track);
+  return t ? t->skipped : 0;
+}
+
+bool DMD_Timeline::tick(unsigned long now)
+{
+  bool drawn = false;
+  for(uint8_t i = 0; i < DMD_TIMELINE_TRACKS; i++) {
+    Track &t = tracks[i];
+    if(t.kind == TRACK_NONE || !t.period)
+      continue;
+
+    unsigned long steps;
+    if(!t.started) {
+      t.started = true;
+      t.due = now + t.period;
+      t.lateness = 0;
+      steps = 0;
+    }
+    else {
+      unsigned long late = now - t.due;
+      if((long)late < 0)
+        continue; // not due yet (compared this way so it still works when millis() wraps)
+      steps = late / t.period + 1;
+      t.due += steps * t.period; // from when this step was due, not now, so there's no drift
+      t.lateness = saturate16(late);
+      if(t.lateness > t.max_lateness)
+        t.max_lateness = t.lateness;
+      if(steps > DMD_TIMELINE_MAX_STEPS && (t.kind == TRACK_FUNCTION || t.kind == TRACK_TICKER)) {
+        t.skipped = saturate16(t.skipped + (steps - DMD_TIMELINE_MAX_STEPS));
+        steps = DMD_TIMELINE_MAX_STEPS;
+      }
+    }
+    if(step(t, steps))
+      drawn = true;
+  }
+
+  if(drawn && dmd)
+    dmd->commitFrame(true);
+  return drawn;
+}
+
+// Update a track for 'steps' steps (0 to draw it as it is), returns true if it drew anything
+bool DMD_Timeline::step(Track &t, unsigned long steps)
+{
+  switch(t.kind) {
+  case TRACK_FUNCTION:
+    t.function(frame, t.target, steps);
+    return true;
+
+  case TRACK_SCROLL:
+    if(!steps)
+      return false;
+    scroll(t, steps);
+    return true;
+
+  case TRACK_BLINK:
+    if(steps & 1)
+      t.position ^= 1;
+    else if(steps)
+      return false; // back where it was
+    if(t.position)
+      frame.copyFrame(*(DMDFrame *)t.target, t.left, t.top);
+    else if(t.width && t.height)
+      frame.drawFilledBox(t.left, t.top, t.left + t.width - 1, t.top + t.height - 1, GRAPHICS_OFF);
+    return true;
+
+  case TRACK_FRAMES:
+    if(steps) {
+      uint8_t next = (t.position + steps % t.count) % t.count;
+      if(next == t.position)
+        return false;
+      t.position = next;
+    }
+    frame.copyFrame(*((DMDFrame **)t.target)[t.position], t.left, t.top);
+    return true;
+
+  case TRACK_TICKER:
+    ((DMD_Ticker *)t.target)->step(steps * t.count); // (0 just redraws it)
+    return true;
+  }
+  return false;
+}
+
+/* Scroll the track's area by however far 'steps' steps take it. The area is rotated a row at a
+   time through a one row buffer, then if it doesn't wrap the pixels that came round are
+   turned off, so nothing is allocated. */
+void DMD_Timeline::scroll(Track &t, unsigned long steps)
+{
+  bool wrap = t.count;
+  int dx = scrollDistance(t.dx, steps, t.width, wrap);
+  int dy = scrollDistance(t.dy, steps, t.height, wrap);
+  uint8_t buffer[MAX_ROW_BYTES];
+
+  if(dx) {
+    uint8_t shift = (dx + t.width) % t.width; // pixels to rotate right by
+    for(uint8_t y = 0; y < t.height; y++) {
+      volatile uint8_t *row = frame.bitmap + frame.rowToBitmapIndex(t.top + y);
+      if(shift) {
+        DMDFrame::copyRowBits(buffer, 0, (const uint8_t *)row, t.left, t.width);
+        DMDFrame::copyRowBits(row, t.left + shift, buffer, 0, t.width - shift);
+        DMDFrame::copyRowBits(row, t.left, buffer, t.width - shift, shift);
+      }
+      if(!wrap)
+        DMDFrame::fillRowBits(row, (dx > 0) ? t.left : t.left + t.width + dx, abs(dx), false);
+    }
+  }
+
+  if(!dy)
+    return;
+  if(frame.ring_rows && t.left == 0 && t.top == 0 && t.width == frame.width && t.height == frame.height) {
+    // Whole frame, which can scroll by rotating its ring of rows without moving any pixels
+    if(wrap)
+      frame.marqueeScrollY(dy);
+    else
+      frame.scrollY(dy);
+    return;
+  }
+
+  uint8_t shift = (dy + t.height) % t.height; // rows to rotate down by
+  if(shift) {
+    // Rows move round in gcd(height, shift) separate cycles, follow each one back from its first row
+    uint8_t cycles = gcd(t.height, shift);
+    for(uint8_t first = 0; first < cycles; first++) {
+      DMDFrame::copyRowBits(buffer, 0, (const uint8_t *)frame.bitmap + frame.rowToBitmapIndex(t.top + first), t.left, t.width);
+      uint8_t to = first;
+      while(true) {
+        uint8_t from = (to + t.height - shift) % t.height;
+        volatile uint8_t *dest = frame.bitmap + frame.rowToBitmapIndex(t.top + to);
+        if(from == first) {
+          DMDFrame::copyRowBits(dest, t.left, buffer, 0, t.width);
+          break;
+        }
+        DMDFrame::copyRowBits(dest, t.left, (const uint8_t *)frame.bitmap + frame.rowToBitmapIndex(t.top + from), t.left, t.width);
+        to = from;
+      }
+    }
+  }
+  if(!wrap) {
+    uint8_t first = (dy > 0) ? 0 : t.height + dy;
+    for(uint8_t y = first; y < first + abs(dy); y++)
+      DMDFrame::fillRowBits(frame.bitmap + frame.rowToBitmapIndex(t.top + y), t.left, t.width, false);
+  }
+}
@@ -45,6 +45,15 @@ void BaseDMD::begin() {
 void BaseDMD::end() {
 }
 
+#ifdef DMD_SCAN_STATS
+void BaseDMD::getTimerStats(DMDScanStats &stats) {
+  stats.reset();
+}
+
+void BaseDMD::resetTimerStats() {
+}
+#endif
+
 #else // Use timers
 
 // Forward declarations for tracking currently running DMDs
@@ -174,6 +183,24 @@ void BaseDMD::end()
 static volatile BaseDMD **running_dmds = 0;
 static volatile int running_dmd_len = 0;
 
+#ifdef DMD_SCAN_STATS
+static DMDScanStats timer_stats; // Statistics for scan_running_dmds(), updated from ISR context
+
+void BaseDMD::getTimerStats(DMDScanStats &stats)
+{
+  DMDInterruptState state = saveInterrupts();
+  stats = timer_stats;
+  restoreInterrupts(state);
+}
+
+void BaseDMD::resetTimerStats()
+{
+  DMDInterruptState state = saveInterrupts();
+  timer_stats.reset();
+  restoreInterrupts(state);
+}
+#endif
+
 // Add a running_dmd to the list (caller must have disabled interrupts)
 static void register_running_dmd(BaseDMD *dmd)
 {
@@ -227,12 +254,19 @@ static void inline ICACHE_RAM_ATTR esp8266_ISR_wrapper()
 // This method is called from timer ISR to scan all the DMD instances present in the running sketch
 static void inline __attribute__((always_inline)) scan_running_dmds()
 {
+#ifdef DMD_SCAN_STATS
+  uint32_t isr_start = DMD_STATS_CLOCK();
+  timer_stats.recordStart(isr_start);
+#endif
   for(int i = 0; i < running_dmd_len; i++) {
     BaseDMD *next = (BaseDMD*)running_dmds[i];
     if(next) {
       next->scanDisplay();
     }
   }
+#ifdef DMD_SCAN_STATS
+  timer_stats.recordScan(isr_start, DMD_STATS_CLOCK());
+#endif
 }
 
 #endif // ifdef NO_TIMERS
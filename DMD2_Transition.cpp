@@ -0,0 +1,219 @@
+/*
+ DMD transition effects
+
+ Wipes, dissolves, pushes and slides from one frame to another. Each step
+ is drawn from the two frames a whole byte (or run of pixels) at a time,
+ a row at a time so ring rows mode and the layout of rows of panels in
+ the bitmap don't matter.
+
+ Copyright (C) 2014 Freetronics, Inc. (info <at> freetronics <dot> com)
+
+---
+
+ This program is free software: you can redistribute it and/or modify it under the terms
+ of the version 3 GNU General Public License as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program.
+ If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "DMD2.h"
+
+const uint16_t DISSOLVE_PIXELS = 512; // 32x16 block
+const uint16_t DISSOLVE_TAPS = 0x110; // x^9 + x^5 + 1, goes through 1-511 before repeating
+
+DMD_Transition::DMD_Transition(DMDFrame &dest, DMDFrame &from, DMDFrame &to, DMDTransitionEffect effect, uint16_t steps) :
+  dest(dest),
+  from(from),
+  to(to),
+  effect(effect),
+  steps(steps ? steps : 1),
+  position(0),
+  mask_count(0),
+  lfsr(1)
+{
+  memset(mask, 0, sizeof(mask));
+}
+
+bool DMD_Transition::step(uint16_t steps)
+{
+  uint16_t next = position + steps;
+  if(next > this->steps || next < position)
+    next = this->steps;
+  render(next);
+  return !done();
+}
+
+void DMD_Transition::timelineStep(DMDFrame &, void *transition, unsigned int steps)
+{
+  ((DMD_Transition *)transition)->step(steps > 0xFFFF ? 0xFFFF : steps);
+}
+
+void DMD_Transition::render(uint16_t position)
+{
+  if(position > steps)
+    position = steps;
+  this->position = position;
+  if(from.width != dest.width || from.height != dest.height
+     || to.width != dest.width || to.height != dest.height)
+    return;
+
+  // How far the transition has got, in pixels across and down
+  unsigned int across = (uint32_t)dest.width * position / steps;
+  unsigned int down = (uint32_t)dest.height * position / steps;
+
+  if(position == 0 || position == steps || effect == TRANSITION_CUT) {
+    DMDFrame &source = position ? to : from;
+    for(unsigned int y = 0; y < dest.height; y++) {
+      volatile uint8_t *d = dest.bitmap + dest.rowToBitmapIndex(y);
+      volatile uint8_t *s = source.bitmap + source.rowToBitmapIndex(y);
+      for(uint8_t i = 0; i < dest.row_width_bytes; i++)
+        d[i] = s[i];
+    }
+    return;
+  }
+
+  switch(effect) {
+  case TRANSITION_WIPE_LEFT:
+    renderWipe(across, true, true);
+    break;
+  case TRANSITION_WIPE_RIGHT:
+    renderWipe(across, true, false);
+    break;
+  case TRANSITION_WIPE_UP:
+    renderWipe(down, false, true);
+    break;
+  case TRANSITION_WIPE_DOWN:
+    renderWipe(down, false, false);
+    break;
+  case TRANSITION_DISSOLVE:
+    updateMask((uint32_t)DISSOLVE_PIXELS * position / steps);
+    renderDissolve();
+    break;
+  case TRANSITION_PUSH_LEFT:
+    renderPush(across, true, true, true);
+    break;
+  case TRANSITION_PUSH_RIGHT:
+    renderPush(across, true, false, true);
+    break;
+  case TRANSITION_PUSH_UP:
+    renderPush(down, false, true, true);
+    break;
+  case TRANSITION_PUSH_DOWN:
+    renderPush(down, false, false, true);
+    break;
+  case TRANSITION_SLIDE_LEFT:
+    renderPush(across, true, true, false);
+    break;
+  case TRANSITION_SLIDE_RIGHT:
+    renderPush(across, true, false, false);
+    break;
+  case TRANSITION_SLIDE_UP:
+    renderPush(down, false, true, false);
+    break;
+  case TRANSITION_SLIDE_DOWN:
+    renderPush(down, false, false, false);
+    break;
+  }
+}
+
+/* New frame from the left (or top) edge up to 'amount' pixels across (or down), or in from the
+   right (or bottom) edge if reversed. Across, the byte the edge falls in is mixed with a mask. */
+void DMD_Transition::renderWipe(unsigned int amount, bool across, bool reverse)
+{
+  DMDFrame &first = reverse ? from : to; // frame shown above/left of the edge
+  DMDFrame &second = reverse ? to : from;
+  unsigned int edge = reverse ? (across ? dest.width : dest.height) - amount : amount;
+  uint8_t edge_byte = edge / 8;
+  uint8_t edge_mask = 0xFF >> (edge & 7); // bits of the edge byte from the second frame
+
+  for(unsigned int y = 0; y < dest.height; y++) {
+    volatile uint8_t *d = dest.bitmap + dest.rowToBitmapIndex(y);
+    volatile uint8_t *a = first.bitmap + first.rowToBitmapIndex(y);
+    volatile uint8_t *b = second.bitmap + second.rowToBitmapIndex(y);
+    if(!across) {
+      volatile uint8_t *s = (y < edge) ? a : b;
+      for(uint8_t i = 0; i < dest.row_width_bytes; i++)
+        d[i] = s[i];
+      continue;
+    }
+    uint8_t i = 0;
+    for(; i < edge_byte; i++)
+      d[i] = a[i];
+    if(i < dest.row_width_bytes) {
+      d[i] = (a[i] & ~edge_mask) | (b[i] & edge_mask);
+      i++;
+    }
+    for(; i < dest.row_width_bytes; i++)
+      d[i] = b[i];
+  }
+}
+
+// Bring the dissolve mask up to 'count' pixels of the new frame, in LFSR order
+void DMD_Transition::updateMask(uint16_t count)
+{
+  if(count < mask_count) {
+    // gone backwards, start again
+    memset(mask, 0, sizeof(mask));
+    mask_count = 0;
+    lfsr = 1;
+  }
+  while(mask_count < count) {
+    uint16_t pixel = (mask_count == DISSOLVE_PIXELS - 1) ? 0 : lfsr; // (0 isn't in the sequence, it goes last)
+    mask[pixel >> 5][(pixel >> 3) & 3] |= 0x80 >> (pixel & 7);
+    lfsr = (lfsr >> 1) ^ ((lfsr & 1) ? DISSOLVE_TAPS : 0);
+    mask_count++;
+  }
+}
+
+void DMD_Transition::renderDissolve()
+{
+  for(unsigned int y = 0; y < dest.height; y++) {
+    volatile uint8_t *d = dest.bitmap + dest.rowToBitmapIndex(y);
+    volatile uint8_t *a = from.bitmap + from.rowToBitmapIndex(y);
+    volatile uint8_t *b = to.bitmap + to.rowToBitmapIndex(y);
+    // Each block of the mask is used from a different row and byte, so neighbouring panels don't dissolve in step
+    uint8_t block_row = y;
+    uint8_t block_col = y >> 4;
+    for(uint8_t i = 0; i < dest.row_width_bytes; i++) {
+      if(i && !(i & 3))
+        block_row += 5;
+      uint8_t m = mask[block_row & 15][(i + block_col) & 3];
+      d[i] = (a[i] & ~m) | (b[i] & m);
+    }
+  }
+}
+
+/* New frame on from the right (or bottom) edge 'amount' pixels, or from the left (or top) edge
+   if reversed. With push the old frame moves along with it, otherwise it stays where it is. */
+void DMD_Transition::renderPush(unsigned int amount, bool across, bool reverse, bool push)
+{
+  unsigned int size = across ? dest.width : dest.height;
+  // Where each frame's part starts in 'dest' and in the frame itself
+  unsigned int to_start = reverse ? size - amount : 0;
+  unsigned int to_from = reverse ? 0 : size - amount;
+  unsigned int from_start = reverse ? 0 : amount;
+  unsigned int from_from = push ? (reverse ? amount : 0) : from_start;
+
+  for(unsigned int y = 0; y < dest.height; y++) {
+    volatile uint8_t *d = dest.bitmap + dest.rowToBitmapIndex(y);
+    if(across) {
+      if(amount)
+        DMDFrame::copyRowBits(d, to_start, (const uint8_t *)to.bitmap + to.rowToBitmapIndex(y), to_from, amount);
+      if(amount < size)
+        DMDFrame::copyRowBits(d, from_start, (const uint8_t *)from.bitmap + from.rowToBitmapIndex(y), from_from, size - amount);
+    }
+    else {
+      volatile uint8_t *s;
+      if(y >= to_start && y < to_start + amount)
+        s = to.bitmap + to.rowToBitmapIndex(y - to_start + to_from);
+      else
+        s = from.bitmap + from.rowToBitmapIndex(y - from_start + from_from);
+      for(uint8_t i = 0; i < dest.row_width_bytes; i++)
+        d[i] = s[i];
+    }
+  }
+}
@@ -0,0 +1,197 @@
+/*
+ VirtualDMD implementation, an emulated chain of DMD panels.
+
+ The model follows the panel hardware as driven by SPIDMD: each panel
+ has a 16 byte shift register (4 bytes across x 4 interleaved rows),
+ chained so that the first bytes shifted out end up in the panel
+ furthest from the controller. A rising edge on the latch (SCK) pin
+ copies the shift registers to the outputs, A/B select which of the 4
+ interleaved sets of rows is lit, and the output enable pin (PWMed for
+ brightness) turns them on.
+
+ Copyright (C) 2014 Freetronics, Inc. (info <at> freetronics <dot> com)
+
+---
+
+ This program is free software: you can redistribute it and/or modify it under the terms
+ of the version 3 GNU General Public License as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program.
+ If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "DMD2.h"
+
+#ifdef DMD2_HOST
+
+// Bytes in each panel's shift register, and in each panel's image
+const unsigned int PANEL_SHIFT_BYTES = 16;
+const unsigned int PANEL_IMAGE_BYTES = PANEL_WIDTH * PANEL_HEIGHT / 8;
+
+// The virtual "pins" are only used to tell the scan outputs apart, no real pins are touched
+VirtualDMD::VirtualDMD(byte panelsWide, byte panelsHigh)
+  : BaseDMD(panelsWide, panelsHigh, 0, 1, 2, 3),
+    chain_length(panelsWide * panelsHigh),
+    shift_head(0),
+    select(0),
+    oe_level(0)
+{
+  shift_reg = (uint8_t *)malloc(chain_length * PANEL_SHIFT_BYTES);
+  latched = (uint8_t *)malloc(chain_length * PANEL_SHIFT_BYTES);
+  shown = (uint8_t *)malloc(chain_length * PANEL_IMAGE_BYTES);
+  memset(shift_reg, 0xFF, chain_length * PANEL_SHIFT_BYTES);
+  memset(latched, 0xFF, chain_length * PANEL_SHIFT_BYTES);
+  memset(shown, 0, chain_length * PANEL_IMAGE_BYTES);
+  resetTiming();
+}
+
+VirtualDMD::~VirtualDMD()
+{
+  free(shift_reg);
+  free(latched);
+  free(shown);
+}
+
+void VirtualDMD::beginNoTimer()
+{
+  // No pins to set up, but otherwise the same as BaseDMD::beginNoTimer()
+  clearScreen();
+  scanDisplay();
+}
+
+void VirtualDMD::writeSPIData(volatile uint8_t *rows[4], const int rowsize)
+{
+  // Same byte order as SPIDMD::writeSPIData(), shifted into the chain
+  const uint16_t chain_bytes = chain_length * PANEL_SHIFT_BYTES;
+  for(int i = 0; i < rowsize; i++) {
+    for(int r = 3; r >= 0; r--) {
+      shift_reg[shift_head] = *(rows[r]++);
+      shift_head = (shift_head + 1) % chain_bytes;
+    }
+  }
+}
+
+void VirtualDMD::writeScanPin(byte pin, byte value)
+{
+  if(pin == pin_sck) {
+    if(value) {
+      // Rising edge of the latch, shift register contents appear on the outputs
+      const uint16_t chain_bytes = chain_length * PANEL_SHIFT_BYTES;
+      for(uint16_t i = 0; i < chain_bytes; i++)
+        latched[i] = shift_reg[(shift_head + i) % chain_bytes];
+      updateOutput(oe_level);
+    }
+  }
+  else if(pin == pin_a || pin == pin_b) {
+    byte bit = (pin == pin_a) ? 0x01 : 0x02;
+    byte new_select = value ? (select | bit) : (select & ~bit);
+    if(new_select != select) {
+      byte level = oe_level;
+      updateOutput(0); // account for time on the old row select
+      select = new_select;
+      updateOutput(level);
+    }
+  }
+  else if(pin == pin_noe) {
+    updateOutput(value ? 255 : 0);
+  }
+}
+
+void VirtualDMD::writeScanBrightness(byte pin, byte level)
+{
+  if(pin == pin_noe)
+    updateOutput(level);
+}
+
+// Account for lit time since the last change, then apply the new output enable level
+// and refresh the rows that are now being shown.
+void VirtualDMD::updateOutput(byte new_level)
+{
+  uint32_t now = micros();
+  on_time[select] += ((now - last_change) * oe_level) / 255;
+  last_change = now;
+  oe_level = new_level;
+
+  if(!oe_level)
+    return;
+
+  const uint16_t chain_bytes = chain_length * PANEL_SHIFT_BYTES;
+  for(byte chain_pos = 0; chain_pos < chain_length; chain_pos++) {
+    // Panel nearest the controller holds the most recently shifted bytes
+    const uint8_t *panel_bytes = latched + chain_bytes - (chain_pos + 1) * PANEL_SHIFT_BYTES;
+    uint8_t *image = shown + chain_pos * PANEL_IMAGE_BYTES;
+    for(byte i = 0; i < PANEL_SHIFT_BYTES; i++) {
+      // Each column of 4 bytes holds rows 12,8,4,0 (offset by the row select), in order sent
+      byte row = select + 4 * (3 - (i % 4));
+      byte col = i / 4;
+      image[row * (PANEL_WIDTH / 8) + col] = ~panel_bytes[i]; // bitmap bits are inverted, set = off
+    }
+  }
+}
+
+bool VirtualDMD::getPanelPixel(byte chain_pos, unsigned int x, unsigned int y)
+{
+  if(chain_pos >= chain_length || x >= PANEL_WIDTH || y >= PANEL_HEIGHT)
+    return false;
+  uint8_t b = shown[chain_pos * PANEL_IMAGE_BYTES + y * (PANEL_WIDTH / 8) + x / 8];
+  return b & pixelToBitmask(x);
+}
+
+bool VirtualDMD::getShownPixel(unsigned int x, unsigned int y)
+{
+  if(x >= width || y >= height)
+    return false;
+  // Panels are numbered left to right, top to bottom, and the last panel is first in the chain
+  byte panel = (x / PANEL_WIDTH) + (width / PANEL_WIDTH) * (y / PANEL_HEIGHT);
+  return getPanelPixel(chain_length - 1 - panel, x % PANEL_WIDTH, y % PANEL_HEIGHT);
+}
+
+void VirtualDMD::writePBM(Print &out)
+{
+  // Plain PBM, 1 = lit
+  out.print("P1\n");
+  out.print(width);
+  out.print(' ');
+  out.print(height);
+  out.print('\n');
+  for(unsigned int y = 0; y < height; y++) {
+    for(unsigned int x = 0; x < width; x++) {
+      out.print(getShownPixel(x, y) ? '1' : '0');
+      out.print(x == width - 1U ? '\n' : ' ');
+    }
+  }
+}
+
+void VirtualDMD::writeASCII(Print &out)
+{
+  for(unsigned int y = 0; y < height; y++) {
+    for(unsigned int x = 0; x < width; x++) {
+      out.print(getShownPixel(x, y) ? '#' : '.');
+    }
+    out.print('\n');
+  }
+}
+
+uint32_t VirtualDMD::rowOnTime(byte row)
+{
+  updateOutput(oe_level); // bring the totals up to date
+  return on_time[row % 4];
+}
+
+float VirtualDMD::rowDuty(byte row)
+{
+  uint32_t on = rowOnTime(row);
+  uint32_t elapsed = last_change - start_time;
+  return elapsed ? (float)on / elapsed : 0;
+}
+
+void VirtualDMD::resetTiming()
+{
+  last_change = start_time = micros();
+  memset(on_time, 0, sizeof(on_time));
+}
+
+#endif // ifdef DMD2_HOST
@@ -25,7 +25,11 @@ DMDFrame::DMDFrame(byte pixelsWide, byte pixelsHigh)
   :
   width(pixelsWide),
   height(pixelsHigh),
-  font(0)
+  ring_rows(false),
+  row_offset(0),
+  font(0),
+  font_source(0),
+  glyph_offsets(0)
 {
   row_width_bytes = (pixelsWide + 7)/8; // on full panels pixelsWide is a multiple of 8, but for sub-regions may not be
   height_in_panels = (pixelsHigh + PANEL_HEIGHT-1) / PANEL_HEIGHT;
@@ -38,15 +42,27 @@ DMDFrame::DMDFrame(const DMDFrame &source) :
   height(source.height),
   row_width_bytes(source.row_width_bytes),
   height_in_panels(source.height_in_panels),
-  font(source.font)
+  ring_rows(source.ring_rows),
+  row_offset(source.row_offset),
+  font(source.font),
+  font_source(source.font_source),
+  font_header(source.font_header),
+  glyph_offsets(0)
 {
   bitmap = (uint8_t *)malloc(bitmap_bytes());
   memcpy((void *)bitmap, (void *)source.bitmap, bitmap_bytes());
+  if(source.glyph_offsets) {
+    size_t offsets_size = sizeof(uint16_t) * ((font_header.charCount + DMD_GLYPH_OFFSET_STRIDE - 1) / DMD_GLYPH_OFFSET_STRIDE);
+    glyph_offsets = (uint16_t *)malloc(offsets_size);
+    if(glyph_offsets)
+      memcpy(glyph_offsets, source.glyph_offsets, offsets_size);
+  }
 }
 
 DMDFrame::~DMDFrame()
 {
   free((void *)bitmap);
+  free(glyph_offsets);
 }
 
 void DMDFrame::swapBuffers(DMDFrame &other)
@@ -59,6 +75,10 @@ void DMDFrame::swapBuffers(DMDFrame &other)
   volatile uint8_t *temp = other.bitmap;
   other.bitmap = this->bitmap;
   this->bitmap = temp;
+  // Row order goes with the bitmap
+  byte temp_offset = other.row_offset;
+  other.row_offset = this->row_offset;
+  this->row_offset = temp_offset;
 #ifdef __AVR__
   SREG = oldSREG;
 #endif
@@ -129,17 +149,55 @@ void DMDFrame::movePixels(unsigned int from_x, unsigned int from_y,
                          unsigned int to_x, unsigned int to_y,
                          unsigned int width, unsigned int height)
 {
-  // NB: This implementation is actually a copy-erase so
-  // it uses more RAM than a real move implementation would
-  // do (however bypasses issues around overlapping regions.)
-
   if(from_x >= this->width || from_y >= this->height
      || to_x >= this->width || to_y >= this->height)
     return;
 
-  DMDFrame to_move = this->subFrame(from_x, from_y, width, height);
-  this->drawFilledBox(from_x,from_y,from_x+width-1,from_y+height-1,GRAPHICS_OFF);
-  this->copyFrame(to_move, to_x, to_y);
+  // Only move what's inside the frame at both ends, everything else in the
+  // original and destination areas is turned off below
+  unsigned int from_right = (from_x + width < this->width) ? from_x + width : this->width;
+  unsigned int from_bottom = (from_y + height < this->height) ? from_y + height : this->height;
+  unsigned int to_right = (to_x + width < this->width) ? to_x + width : this->width;
+  unsigned int to_bottom = (to_y + height < this->height) ? to_y + height : this->height;
+  if(width > from_right - from_x)
+    width = from_right - from_x;
+  if(width > to_right - to_x)
+    width = to_right - to_x;
+  if(height > from_bottom - from_y)
+    height = from_bottom - from_y;
+  if(height > to_bottom - to_y)
+    height = to_bottom - to_y;
+
+  // Move row by row, in place. When moving down start from the bottom row so
+  // no row is overwritten before it has been moved.
+  for(unsigned int i = 0; i < height; i++) {
+    unsigned int r = (to_y > from_y) ? height - 1 - i : i;
+    volatile uint8_t *dest = bitmap + rowToBitmapIndex(to_y + r);
+    volatile uint8_t *src = bitmap + rowToBitmapIndex(from_y + r);
+    if(dest == src)
+      moveRowBits(dest, to_x, from_x, width);
+    else
+      copyRowBits(dest, to_x, (const uint8_t *)src, from_x, width);
+  }
+
+  // Turn off the rest of the original and destination areas
+  const unsigned int areas[2][4] = { { from_x, from_y, from_right, from_bottom },
+                                     { to_x, to_y, to_right, to_bottom } };
+  for(int a = 0; a < 2; a++) {
+    unsigned int x0 = areas[a][0];
+    unsigned int x1 = areas[a][2];
+    for(unsigned int y = areas[a][1]; y < areas[a][3]; y++) {
+      volatile uint8_t *row = bitmap + rowToBitmapIndex(y);
+      if(y < to_y || y >= to_y + height || x1 <= to_x || x0 >= to_x + width) {
+        fillRowBits(row, x0, x1 - x0, false);
+        continue;
+      }
+      if(x0 < to_x)
+        fillRowBits(row, x0, to_x - x0, false);
+      if(x1 > to_x + width)
+        fillRowBits(row, to_x + width, x1 - (to_x + width), false);
+    }
+  }
 }
 
 // Set the entire screen
@@ -222,6 +280,21 @@ void DMDFrame::drawBox(unsigned int x1, unsigned int y1, unsigned int x2, unsign
 
 void DMDFrame::drawFilledBox(unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2, DMDGraphicsMode mode)
 {
+  if (x2 >= width)
+    x2 = width - 1; // nothing to draw past the right edge (also stops x2 "below" zero looping forever)
+  if (mode == GRAPHICS_ON || mode == GRAPHICS_OFF) {
+    // Fill whole rows of bytes at a time, clipped the same way as drawing the lines would be
+    int top = y1, bottom = y2;
+    if (top > bottom)
+      swap(top, bottom);
+    if (x1 > x2 || bottom < 0 || top >= (int)height)
+      return;
+    clamp(top, 0, (int)height - 1);
+    clamp(bottom, 0, (int)height - 1);
+    for (int y = top; y <= bottom; y++)
+      fillRowBits(bitmap + rowToBitmapIndex(y), x1, x2 - x1 + 1, mode == GRAPHICS_ON);
+    return;
+  }
   for (unsigned int b = x1; b <= x2; b++) {
     drawLine(b, y1, b, y2, mode);
   }
@@ -232,13 +305,18 @@ void DMDFrame::scrollY(int scrollBy) {
     // scrolling will erase everything
     drawFilledBox(0, 0, width-1, height-1, GRAPHICS_OFF);
   }
-  else if(scrollBy < 0) { // Scroll up
-    movePixels(0, -scrollBy, 0, 0, width, height + scrollBy);
-    drawFilledBox(0, height+scrollBy, width, height, GRAPHICS_OFF);
-  }
-  else if(scrollBy > 0) { // Scroll down
-    movePixels(0, 0, 0, scrollBy, width, height - scrollBy);
-    drawFilledBox(0, 0, width, scrollBy, GRAPHICS_OFF);
+  else if(scrollBy != 0) {
+    if(ring_rows) // Just rotate the ring, no pixels move
+      rotateRows(scrollBy);
+    else if(scrollBy < 0) // Scroll up
+      movePixels(0, -scrollBy, 0, 0, width, height + scrollBy);
+    else // Scroll down
+      movePixels(0, 0, 0, scrollBy, width, height - scrollBy);
+
+    // Clear the rows that scrolled in
+    unsigned int first = (scrollBy < 0) ? height + scrollBy : 0;
+    for(unsigned int y = first; y < first + abs(scrollBy); y++)
+      fillRowBits(bitmap + rowToBitmapIndex(y), 0, width, false);
   }
 }
 
@@ -248,13 +326,16 @@ void DMDFrame::scrollX(int scrollBy) {
     // scrolling will erase everything
     drawFilledBox(0, 0, width-1, height-1, GRAPHICS_OFF);
   }
-  else if(scrollBy < 0) { // Scroll left
-    movePixels(-scrollBy, 0, 0, 0, width + scrollBy, height);
-    drawFilledBox(width+scrollBy, 0, width, height, GRAPHICS_OFF);
-  }
-  else { // Scroll right
-    movePixels(0, 0, scrollBy, 0, width - scrollBy, height);
-    drawFilledBox(0, 0, scrollBy, height, GRAPHICS_OFF);
+  else if(scrollBy != 0) {
+    if(scrollBy < 0) // Scroll left
+      movePixels(-scrollBy, 0, 0, 0, width + scrollBy, height);
+    else // Scroll right
+      movePixels(0, 0, scrollBy, 0, width - scrollBy, height);
+
+    // Clear the columns that scrolled in
+    unsigned int first = (scrollBy < 0) ? width + scrollBy : 0;
+    for(unsigned int y = 0; y < height; y++)
+      fillRowBits(bitmap + rowToBitmapIndex(y), first, abs(scrollBy), false);
   }
 }
 
@@ -277,7 +358,9 @@ void DMDFrame::marqueeScrollX(int scrollBy) {
 void DMDFrame::marqueeScrollY(int scrollBy) {
   scrollBy = scrollBy % height;
 
-  if(scrollBy < 0) { // Scroll up
+  if(ring_rows) { // Rows that scroll off one edge are already in place to scroll in at the other
+    rotateRows(scrollBy);
+  } else if(scrollBy < 0) { // Scroll up
     DMDFrame frame = subFrame(0, 0, width, -scrollBy); // save topmost
     movePixels(0, -scrollBy, 0, 0, width, height+scrollBy); // move
     copyFrame(frame, 0, height+scrollBy); // drop back at bottom edge
@@ -289,6 +372,43 @@ void DMDFrame::marqueeScrollY(int scrollBy) {
 }
 
 
+// Move every row of the frame down by scrollBy (up if negative) by changing the
+// row offset, wrapping around at the bottom (top)
+void DMDFrame::rotateRows(int scrollBy)
+{
+  int offset = ((int)row_offset - scrollBy) % (int)height;
+  if(offset < 0)
+    offset += height;
+  row_offset = offset;
+}
+
+void DMDFrame::setRingRows(bool enable)
+{
+  ring_rows = enable;
+  if(enable || !row_offset)
+    return;
+
+  // Put the stored rows back in order by rotating them left by row_offset, in place,
+  // as three reversals of the row order
+  unsigned int bounds[3][2] = { { 0, row_offset }, { row_offset, height }, { 0, height } };
+  for(int r = 0; r < 3; r++) {
+    unsigned int lo = bounds[r][0];
+    unsigned int hi = bounds[r][1];
+    while(hi - lo > 1) {
+      hi--;
+      volatile uint8_t *a = bitmap + storedRowToBitmapIndex(lo);
+      volatile uint8_t *b = bitmap + storedRowToBitmapIndex(hi);
+      for(byte i = 0; i < row_width_bytes; i++) {
+        uint8_t t = a[i];
+        a[i] = b[i];
+        b[i] = t;
+      }
+      lo++;
+    }
+  }
+  row_offset = 0;
+}
+
 DMDFrame DMDFrame::subFrame(unsigned int left, unsigned int top, unsigned int width, unsigned int height)
 {
   DMDFrame result(width, height);
@@ -348,6 +468,111 @@ void DMDFrame::copyFrame(DMDFrame &from, unsigned int left, unsigned int top)
   }
 }
 
+// The linear format is the bitmap's row layout with the bits inverted, so each row is a byte
+// copy. Padding bits past the right edge of the frame are stored as off.
+static inline void importRow(volatile uint8_t *dest, const uint8_t *src, uint8_t bytes, uint8_t padding, bool progmem)
+{
+  for(uint8_t i = 0; i < bytes; i++)
+    dest[i] = ~(progmem ? pgm_read_byte(src + i) : src[i]);
+  dest[bytes - 1] |= padding;
+}
+
+void DMDFrame::importLinear(const uint8_t *src, unsigned int stride)
+{
+  if(stride < row_width_bytes)
+    stride = row_width_bytes;
+  uint8_t padding = (width & 7) ? 0xFF >> (width & 7) : 0;
+  for(unsigned int y = 0; y < height; y++, src += stride)
+    importRow(bitmap + rowToBitmapIndex(y), src, row_width_bytes, padding, false);
+}
+
+#if defined(__AVR__) || defined(ESP8266)
+void DMDFrame::importLinear_P(const uint8_t *src, unsigned int stride)
+{
+  if(stride < row_width_bytes)
+    stride = row_width_bytes;
+  uint8_t padding = (width & 7) ? 0xFF >> (width & 7) : 0;
+  for(unsigned int y = 0; y < height; y++, src += stride)
+    importRow(bitmap + rowToBitmapIndex(y), src, row_width_bytes, padding, true);
+}
+#endif
+
+void DMDFrame::exportLinear(uint8_t *dest, unsigned int stride)
+{
+  if(stride < row_width_bytes)
+    stride = row_width_bytes;
+  uint8_t padding = (width & 7) ? 0xFF >> (width & 7) : 0;
+  for(unsigned int y = 0; y < height; y++, dest += stride) {
+    const volatile uint8_t *row = bitmap + rowToBitmapIndex(y);
+    for(uint8_t i = 0; i < row_width_bytes; i++)
+      dest[i] = ~row[i];
+    dest[row_width_bytes - 1] &= ~padding; // padding bits are off (clear)
+  }
+}
+
+// Copy a run of pixels between two bitmap-style rows, one destination byte at a time
+void DMDFrame::copyRowBits(volatile uint8_t *dest, unsigned int dest_x, const uint8_t *src, unsigned long src_x, unsigned int count)
+{
+  dest += dest_x / 8;
+  uint8_t dest_bit = dest_x & 7;
+  src += src_x / 8;
+  uint8_t src_bit = src_x & 7;
+  while(count) {
+    uint8_t n = 8 - dest_bit;
+    if(n > count)
+      n = count;
+    // next n source bits, aligned to the top of the byte
+    uint8_t bits = src[0] << src_bit;
+    if(src_bit + n > 8)
+      bits |= src[1] >> (8 - src_bit);
+    uint8_t mask = (uint8_t)(0xFF << (8 - n)) >> dest_bit;
+    *dest = (*dest & ~mask) | ((bits >> dest_bit) & mask);
+    dest++;
+    dest_bit = 0;
+    src_bit += n;
+    src += src_bit / 8;
+    src_bit &= 7;
+    count -= n;
+  }
+}
+
+void DMDFrame::moveRowBits(volatile uint8_t *row, unsigned int dest_x, unsigned int src_x, unsigned int count)
+{
+  if(dest_x <= src_x) {
+    // Copying towards the start of the row never overwrites bits that are still to be read
+    copyRowBits(row, dest_x, (const uint8_t *)row, src_x, count);
+    return;
+  }
+  // Otherwise copy from the end of the row backwards, one destination byte at a time
+  unsigned int dest_end = dest_x + count;
+  while(count) {
+    uint8_t n = dest_end & 7;
+    if(!n)
+      n = 8;
+    if(n > count)
+      n = count;
+    count -= n;
+    dest_end -= n;
+    copyRowBits(row, dest_end, (const uint8_t *)row, src_x + count, n);
+  }
+}
+
+void DMDFrame::fillRowBits(volatile uint8_t *dest, unsigned int dest_x, unsigned int count, bool on)
+{
+  dest += dest_x / 8;
+  uint8_t dest_bit = dest_x & 7;
+  while(count) {
+    uint8_t n = 8 - dest_bit;
+    if(n > count)
+      n = count;
+    uint8_t mask = (uint8_t)(0xFF << (8 - n)) >> dest_bit;
+    *dest = on ? (*dest & ~mask) : (*dest | mask); // bits set = off
+    dest++;
+    dest_bit = 0;
+    count -= n;
+  }
+}
+
 /* Lookup table for DMD pixel locations, marginally faster than bitshifting */
 const PROGMEM uint8_t DMD_Pixel_Lut[] = {
   0x80,   //0, bit 7
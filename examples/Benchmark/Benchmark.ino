@@ -0,0 +1,521 @@
+/*
+  Benchmark of DMD2 drawing, scrolling, copying and text operations
+
+  Times each operation across a range of display geometries and prints
+  the results to the serial port (115200 baud) as one line per operation:
+
+    <panels wide>x<panels high> <operation> <ns per operation> <heap bytes> [<allocations>]
+
+  "heap bytes" is the peak amount of heap the operation grew into beyond
+  the current top of the heap (ie temporary frames allocated while it
+  runs.) It is only measured on AVR, other boards print "-".
+
+  The sketch can also be built and run on a Linux host with the mock
+  Arduino core in extras/host ("make bench" there.) There "heap bytes" is
+  the peak heap in use beyond what was in use before the operation, and
+  the number of heap allocations the operation made is printed as well.
+
+  Geometries that don't fit in RAM are skipped. No displays need to be
+  connected, although any which are will show some interesting patterns.
+ */
+
+#include <SPI.h>
+#include <DMD2.h>
+#include <fonts/SystemFont5x7.h>
+#include <fonts/SystemFont5x7_Extended.h>
+#include <fonts/Arial14.h>
+#include <fonts/Arial14_Packed.h>
+#include <fonts/Droid_Sans_24.h>
+#include <fonts/Droid_Sans_24_Packed.h>
+
+// Geometries (panels wide, panels high) to test. Display width is limited to 255 pixels (7 panels.)
+const byte GEOMETRIES[][2] = {
+  { 1, 1 }, { 2, 1 }, { 4, 1 }, { 2, 2 }, { 4, 2 }, { 7, 2 }, { 4, 4 }, { 7, 4 },
+};
+
+// Number of iterations in each batch of an operation, the slow ones are scaled down from this
+const unsigned int ITERATIONS = 64;
+
+// Each operation is repeated in batches until at least this long has passed, so that even the
+// fastest ones take many ticks of micros()
+const unsigned long MIN_BENCH_MICROS = 10000;
+
+SPIDMD *dmd;
+DMD_TextBox *box;
+DMD_TextLayout *layout;
+
+#ifdef DMD2_HOST
+#include <host.h>
+#endif
+
+#ifdef __AVR__
+extern char *__brkval;
+extern char __heap_start;
+
+static char *heapTop() {
+  return __brkval ? __brkval : &__heap_start;
+}
+
+static int freeMemory() {
+  char top;
+  return &top - heapTop();
+}
+
+const uint8_t HEAP_CANARY = 0xA5;
+const int STACK_MARGIN = 128; // leave this much room below the stack when painting canaries
+
+// Paint the free memory above the heap with a canary value
+static void paintHeap() {
+  char *top = heapTop();
+  memset(top, HEAP_CANARY, freeMemory() - STACK_MARGIN);
+}
+
+// Find how far above the old heap top the canaries were overwritten
+static int heapUsed(char *top) {
+  int limit = freeMemory() - STACK_MARGIN;
+  int used = limit;
+  while(used > 0 && top[used-1] == HEAP_CANARY)
+    used--;
+  return used;
+}
+#endif
+
+// Run an operation in batches of 'iterations' and print the average time per operation
+static void bench(const __FlashStringHelper *name, void (*op)(unsigned int i), unsigned int iterations) {
+#ifdef __AVR__
+  char *top = heapTop();
+  paintHeap();
+  op(0); // first run to measure heap growth
+  int heap = heapUsed(top);
+#elif defined(DMD2_HOST)
+  size_t heap_before = host_getHeapInUse();
+  unsigned long allocations = host_getHeapAllocations();
+  host_resetHeapPeak();
+  op(0);
+  int heap = host_getHeapPeak() - heap_before;
+  allocations = host_getHeapAllocations() - allocations;
+#else
+  op(0);
+#endif
+
+  unsigned long count = 0;
+  unsigned long elapsed;
+  unsigned long start = micros();
+  do {
+    for(unsigned int i = 0; i < iterations; i++)
+      op(i);
+    count += iterations;
+    elapsed = micros() - start;
+  } while(elapsed < MIN_BENCH_MICROS);
+
+  Serial.print(dmd->width / PANEL_WIDTH);
+  Serial.print('x');
+  Serial.print(dmd->height / PANEL_HEIGHT);
+  Serial.print(' ');
+  Serial.print(name);
+  Serial.print(' ');
+  Serial.print((elapsed / count) * 1000 + ((elapsed % count) * 1000) / count);
+  Serial.print(' ');
+#ifdef __AVR__
+  Serial.println(heap);
+#elif defined(DMD2_HOST)
+  Serial.print(heap);
+  Serial.print(' ');
+  Serial.println(allocations);
+#else
+  Serial.println('-');
+#endif
+}
+
+/* Operations. 'i' is the iteration number, used to vary coordinates */
+
+static void op_setPixel(unsigned int i) {
+  dmd->setPixel(i % dmd->width, i % dmd->height, GRAPHICS_XOR);
+}
+
+static void op_getPixel(unsigned int i) {
+  dmd->getPixel(i % dmd->width, i % dmd->height);
+}
+
+static void op_drawLine(unsigned int i) {
+  dmd->drawLine(0, i % dmd->height, dmd->width - 1, dmd->height - 1 - (i % dmd->height), GRAPHICS_XOR);
+}
+
+static void op_drawCircle(unsigned int i) {
+  dmd->drawCircle(dmd->width / 2, dmd->height / 2, dmd->height / 2 - 1, GRAPHICS_XOR);
+}
+
+static void op_drawBox(unsigned int i) {
+  dmd->drawBox(0, 0, dmd->width - 1, dmd->height - 1, GRAPHICS_XOR);
+}
+
+static void op_drawFilledBox(unsigned int i) {
+  dmd->drawFilledBox(0, 0, dmd->width - 1, dmd->height - 1, GRAPHICS_XOR);
+}
+
+static void op_fillScreen(unsigned int i) {
+  dmd->fillScreen(i & 1);
+}
+
+static void op_scrollX(unsigned int i) {
+  dmd->scrollX((i & 1) ? 1 : -1);
+}
+
+static void op_scrollY(unsigned int i) {
+  dmd->scrollY((i & 1) ? 1 : -1);
+}
+
+static void op_marqueeScrollX(unsigned int i) {
+  dmd->marqueeScrollX(1);
+}
+
+static void op_marqueeScrollY(unsigned int i) {
+  dmd->marqueeScrollY(1);
+}
+
+static void op_movePixels(unsigned int i) {
+  dmd->movePixels(1, 1, 3, 2, dmd->width - 4, dmd->height - 3);
+}
+
+static void op_copyFrameAligned(unsigned int i) {
+  DMDFrame part = dmd->subFrame(0, 0, PANEL_WIDTH, PANEL_HEIGHT);
+  dmd->copyFrame(part, dmd->width - PANEL_WIDTH, dmd->height - PANEL_HEIGHT);
+}
+
+static void op_copyFrameUnaligned(unsigned int i) {
+  DMDFrame part = dmd->subFrame(3, 1, 20, 10);
+  dmd->copyFrame(part, 5, 3);
+}
+
+// Game of Life the way the GameOfLife example used to do it, with getPixel() for every neighbour
+static void op_lifeGetPixel(unsigned int i) {
+  DMDFrame current(*dmd);
+  for(int x = 0; x < dmd->width; x++) {
+    for(int y = 0; y < dmd->height; y++) {
+      bool state = current.getPixel(x,y);
+      int live_neighbours = 0;
+      for(int nx = x - 1; nx < x + 2; nx++) {
+        for(int ny = y - 1; ny < y + 2; ny++) {
+          if((nx != x || ny != y) && current.getPixel(nx,ny))
+            live_neighbours++;
+        }
+      }
+      if(state && (live_neighbours < 2 || live_neighbours > 3))
+        state = false;
+      else if(!state && live_neighbours == 3)
+        state = true;
+      dmd->setPixel(x,y,state ? GRAPHICS_ON : GRAPHICS_OFF);
+    }
+  }
+}
+
+static void op_stepLife(unsigned int i) {
+  dmd->stepLife();
+}
+
+static void op_dilate(unsigned int i) {
+  dmd->dilate();
+}
+
+static void op_erode(unsigned int i) {
+  dmd->erode();
+}
+
+static void op_outline(unsigned int i) {
+  dmd->outline();
+}
+
+// Fill the display with a random 30% of pixels on, for the neighbourhood operations
+static void randomPixels() {
+  dmd->clearScreen();
+  for(int x = 0; x < dmd->width; x++) {
+    for(int y = 0; y < dmd->height; y++) {
+      if(random(100) < 30)
+        dmd->setPixel(x,y);
+    }
+  }
+}
+
+static void op_compareFrames(unsigned int i) {
+  DMDFrame copy(*dmd);
+  if(copy != *dmd)
+    Serial.println(F("compareFrames: copy is different!"));
+}
+
+static void op_pixelHash(unsigned int i) {
+  dmd->pixelHash();
+}
+
+static void op_countPixelsOn(unsigned int i) {
+  dmd->countPixelsOn();
+}
+
+// Load a whole frame from a plain row-major bitmap, pixel by pixel and with importLinear()
+static void op_importSetPixel(unsigned int i) {
+  size_t stride = (dmd->width + 7) / 8;
+  uint8_t *linear = (uint8_t *)malloc(stride * dmd->height);
+  if(!linear)
+    return;
+  memset(linear, 0x5A ^ i, stride * dmd->height);
+  for(int y = 0; y < dmd->height; y++) {
+    for(int x = 0; x < dmd->width; x++) {
+      bool on = linear[y * stride + x / 8] & (0x80 >> (x & 7));
+      dmd->setPixel(x, y, on ? GRAPHICS_ON : GRAPHICS_OFF);
+    }
+  }
+  free(linear);
+}
+
+static void op_importLinear(unsigned int i) {
+  size_t stride = (dmd->width + 7) / 8;
+  uint8_t *linear = (uint8_t *)malloc(stride * dmd->height);
+  if(!linear)
+    return;
+  memset(linear, 0x5A ^ i, stride * dmd->height);
+  dmd->importLinear(linear);
+  free(linear);
+}
+
+static void op_exportLinear(unsigned int i) {
+  size_t stride = (dmd->width + 7) / 8;
+  uint8_t *linear = (uint8_t *)malloc(stride * dmd->height);
+  if(!linear)
+    return;
+  dmd->exportLinear(linear);
+  free(linear);
+}
+
+// Decode a full frame packet with DMD_StreamReceiver (the time includes working out the CRC to send)
+static void op_streamFullFrame(unsigned int i) {
+  DMDFrame back(dmd->width, dmd->height);
+  DMD_StreamReceiver receiver(*dmd, back);
+  uint16_t length = ((dmd->width + 7) / 8) * dmd->height;
+  uint8_t header[] = { DMD_STREAM_SYNC1, DMD_STREAM_SYNC2, DMD_STREAM_FULL, (uint8_t)length, (uint8_t)(length >> 8) };
+  uint16_t crc = 0xFFFF;
+  receiver.write(header, sizeof(header));
+  for(int j = 2; j < 5; j++)
+    crc = DMD_StreamReceiver::crcUpdate(crc, header[j]);
+  for(uint16_t j = 0; j < length; j++) {
+    uint8_t pixels = 0x5A ^ i ^ j;
+    crc = DMD_StreamReceiver::crcUpdate(crc, pixels);
+    receiver.write(pixels);
+  }
+  receiver.write(crc & 0xFF);
+  receiver.write(crc >> 8);
+  while(dmd->presentPending())
+    dmd->scanDisplay(); // (no timer, so the swap happens here)
+  if(receiver.getFrameCount() != 1)
+    Serial.println(F("streamFullFrame: frame wasn't received!"));
+}
+
+// One step of a timeline scrolling (and wrapping) a region of the display
+static void op_timelineScroll(unsigned int i) {
+  DMD_Timeline timeline(*dmd);
+  timeline.addScroll(10, 1, 0, true, 3, 1, dmd->width - 6, dmd->height - 2);
+  timeline.tick(0);
+  timeline.tick(10);
+}
+
+// One step part way through a transition from a copy of the display to a blank frame
+static void transitionStep(unsigned int i, DMDTransitionEffect effect) {
+  DMDFrame from(*dmd);
+  DMDFrame to(dmd->width, dmd->height);
+  DMD_Transition transition(*dmd, from, to, effect, 16);
+  transition.render(1 + i % 15);
+}
+
+static void op_transitionWipe(unsigned int i) {
+  transitionStep(i, TRANSITION_WIPE_RIGHT);
+}
+
+static void op_transitionDissolve(unsigned int i) {
+  transitionStep(i, TRANSITION_DISSOLVE);
+}
+
+static void op_transitionPush(unsigned int i) {
+  transitionStep(i, TRANSITION_PUSH_LEFT);
+}
+
+// Dither a whole display of 8 bit greyscale (a diagonal gradient), a pixel at a time
+static void ditherFrame(unsigned int i, DMDDitherMethod method) {
+  DMD_Dither dither(*dmd, method);
+  for(int y = 0; y < dmd->height; y++) {
+    for(int x = 0; x < dmd->width; x++)
+      dither.write((uint8_t)(x * 2 + y * 4 + i));
+  }
+}
+
+static void op_ditherBayer(unsigned int i) {
+  ditherFrame(i, DITHER_BAYER);
+}
+
+static void op_ditherFloydSteinberg(unsigned int i) {
+  ditherFrame(i, DITHER_FLOYD_STEINBERG);
+}
+
+static void op_drawChar(unsigned int i) {
+  dmd->drawChar(i % dmd->width, 0, 'a' + (i % 26));
+}
+
+static void op_drawString(unsigned int i) {
+  dmd->drawString(0, 0, "Hello World!");
+}
+
+static void op_drawStringUTF8(unsigned int i) {
+  dmd->drawString(0, 0, "Caf\xC3\xA9 21\xC2\xB0 \xE2\x82\xAC" "5");
+}
+
+static void op_drawStringScaled2(unsigned int i) {
+  dmd->drawStringScaled(0, 0, "12:34", 2);
+}
+
+static void op_drawStringScaled4(unsigned int i) {
+  dmd->drawStringScaled(0, 0, "12:34", 4);
+}
+
+static void op_stringWidth(unsigned int i) {
+  dmd->stringWidth("Hello World!");
+}
+
+static void op_textBoxPrint(unsigned int i) {
+  box->print(i);
+}
+
+static void op_textBoxPrintLine(unsigned int i) {
+  box->println("Hello World! The quick brown fox");
+}
+
+static void op_layoutText(unsigned int i) {
+  layout->drawText("Hello World! The quick brown fox");
+}
+
+static void op_scanDisplay(unsigned int i) {
+  dmd->scanDisplay();
+}
+
+static void benchGeometry(byte panelsWide, byte panelsHigh) {
+#ifdef __AVR__
+  size_t bytes = (size_t)panelsWide * PANEL_WIDTH * panelsHigh * PANEL_HEIGHT / 8;
+  // Need room for the display and at least one full-size temporary frame
+  if(freeMemory() < (int)(bytes * 2 + STACK_MARGIN * 2)) {
+    Serial.print(panelsWide);
+    Serial.print('x');
+    Serial.print(panelsHigh);
+    Serial.println(F(" skipped, not enough RAM"));
+    return;
+  }
+#endif
+
+  dmd = new SPIDMD(panelsWide, panelsHigh);
+  dmd->beginNoTimer();
+  box = new DMD_TextBox(*dmd);
+  layout = new DMD_TextLayout(*dmd);
+
+  bench(F("setPixel"), op_setPixel, ITERATIONS * 16);
+  bench(F("getPixel"), op_getPixel, ITERATIONS * 16);
+  bench(F("drawLine"), op_drawLine, ITERATIONS);
+  bench(F("drawCircle"), op_drawCircle, ITERATIONS);
+  bench(F("drawBox"), op_drawBox, ITERATIONS);
+  bench(F("drawFilledBox"), op_drawFilledBox, ITERATIONS / 4);
+  bench(F("fillScreen"), op_fillScreen, ITERATIONS);
+  bench(F("scrollX"), op_scrollX, ITERATIONS / 4);
+  bench(F("scrollY"), op_scrollY, ITERATIONS / 4);
+  bench(F("marqueeScrollX"), op_marqueeScrollX, ITERATIONS / 4);
+  bench(F("marqueeScrollY"), op_marqueeScrollY, ITERATIONS / 4);
+  dmd->setRingRows(true);
+  bench(F("scrollYRing"), op_scrollY, ITERATIONS / 4);
+  bench(F("marqueeScrollYRing"), op_marqueeScrollY, ITERATIONS / 4);
+  bench(F("scanDisplayRing"), op_scanDisplay, ITERATIONS);
+  dmd->setRingRows(false);
+  bench(F("movePixels"), op_movePixels, ITERATIONS / 4);
+  bench(F("timelineScroll"), op_timelineScroll, ITERATIONS / 4);
+  bench(F("transitionWipe"), op_transitionWipe, ITERATIONS / 4);
+  bench(F("transitionDissolve"), op_transitionDissolve, ITERATIONS / 4);
+  bench(F("transitionPush"), op_transitionPush, ITERATIONS / 4);
+  bench(F("ditherBayer"), op_ditherBayer, ITERATIONS / 16);
+  bench(F("ditherFloydSteinberg"), op_ditherFloydSteinberg, ITERATIONS / 16);
+  bench(F("copyFrameAligned"), op_copyFrameAligned, ITERATIONS / 4);
+  bench(F("copyFrameUnaligned"), op_copyFrameUnaligned, ITERATIONS / 4);
+  bench(F("importSetPixel"), op_importSetPixel, ITERATIONS / 16);
+  bench(F("importLinear"), op_importLinear, ITERATIONS / 4);
+  bench(F("exportLinear"), op_exportLinear, ITERATIONS / 4);
+  bench(F("streamFullFrame"), op_streamFullFrame, ITERATIONS / 4);
+
+  randomPixels();
+  bench(F("lifeGetPixel"), op_lifeGetPixel, 1);
+  randomPixels();
+  bench(F("stepLife"), op_stepLife, ITERATIONS / 4);
+  randomPixels();
+  bench(F("dilate"), op_dilate, ITERATIONS / 4);
+  randomPixels();
+  bench(F("erode"), op_erode, ITERATIONS / 4);
+  randomPixels();
+  bench(F("outline"), op_outline, ITERATIONS / 4);
+  randomPixels();
+  bench(F("compareFrames"), op_compareFrames, ITERATIONS / 4);
+  bench(F("pixelHash"), op_pixelHash, ITERATIONS);
+  bench(F("countPixelsOn"), op_countPixelsOn, ITERATIONS);
+
+  dmd->selectFont(SystemFont5x7);
+  bench(F("drawChar5x7"), op_drawChar, ITERATIONS);
+  bench(F("drawString5x7"), op_drawString, ITERATIONS / 4);
+  bench(F("stringWidth5x7"), op_stringWidth, ITERATIONS);
+  bench(F("drawStringScaled2x5x7"), op_drawStringScaled2, ITERATIONS / 4);
+  bench(F("drawStringScaled4x5x7"), op_drawStringScaled4, ITERATIONS / 4);
+  dmd->selectFont(SystemFont5x7_Extended);
+  bench(F("drawString5x7Sparse"), op_drawString, ITERATIONS / 4);
+  bench(F("drawStringUTF8Sparse"), op_drawStringUTF8, ITERATIONS / 4);
+  bench(F("stringWidth5x7Sparse"), op_stringWidth, ITERATIONS);
+  dmd->selectFont(Arial14);
+  bench(F("drawCharArial14"), op_drawChar, ITERATIONS);
+  bench(F("drawStringArial14"), op_drawString, ITERATIONS / 4);
+  bench(F("stringWidthArial14"), op_stringWidth, ITERATIONS);
+  bench(F("textBoxPrint"), op_textBoxPrint, ITERATIONS);
+  bench(F("textBoxPrintLine"), op_textBoxPrintLine, ITERATIONS / 4);
+  bench(F("layoutTextArial14"), op_layoutText, ITERATIONS / 4);
+  dmd->selectFont(Arial14_Packed);
+  bench(F("drawCharArial14Packed"), op_drawChar, ITERATIONS);
+  bench(F("drawStringArial14Packed"), op_drawString, ITERATIONS / 4);
+  dmd->selectFont(Droid_Sans_24);
+  bench(F("drawCharDroidSans24"), op_drawChar, ITERATIONS);
+  dmd->selectFont(Droid_Sans_24_Packed);
+  bench(F("drawCharDroidSans24Packed"), op_drawChar, ITERATIONS);
+
+  bench(F("scanDisplay"), op_scanDisplay, ITERATIONS);
+
+  dmd->clearScreen();
+  dmd->scanDisplay();
+  delete box;
+  delete layout;
+  delete dmd;
+  dmd = NULL;
+}
+
+static void printFontSize(const __FlashStringHelper *name, size_t size, size_t packed_size) {
+  Serial.print(F("font "));
+  Serial.print(name);
+  Serial.print(' ');
+  Serial.print((unsigned int)size);
+  Serial.print(F(" bytes, packed "));
+  Serial.print((unsigned int)packed_size);
+  Serial.println(F(" bytes"));
+}
+
+// the setup routine runs once when you press reset:
+void setup() {
+  Serial.begin(115200);
+  Serial.println(F("DMD2 benchmark: geometry operation ns/op heap"));
+
+  // Flash used by the fonts, normal and packed
+  printFontSize(F("Arial14"), sizeof(Arial14), sizeof(Arial14_Packed));
+  printFontSize(F("DroidSans24"), sizeof(Droid_Sans_24), sizeof(Droid_Sans_24_Packed));
+
+  for(unsigned int g = 0; g < sizeof(GEOMETRIES) / sizeof(GEOMETRIES[0]); g++) {
+    benchGeometry(GEOMETRIES[g][0], GEOMETRIES[g][1]);
+  }
+  Serial.println(F("Done."));
+}
+
+// the loop routine runs over and over again forever:
+void loop() {
+}
@@ -0,0 +1,55 @@
+/*
+  Pan around a "dashboard" that's bigger than the display
+
+  Three pages are drawn side by side on a canvas three displays wide, and
+  the display pans smoothly from one page to the next. Only the counter
+  on the middle page is ever redrawn, moving the viewport doesn't copy any
+  pixels around (the display just scans out a different part of the canvas.)
+ */
+
+#include <SPI.h>
+#include <DMD2.h>
+#include <fonts/SystemFont5x7.h>
+
+#define DISPLAYS_WIDE 1
+#define DISPLAYS_HIGH 1
+#define PAGES 3
+
+SoftDMD dmd(DISPLAYS_WIDE,DISPLAYS_HIGH);
+DMDFrame canvas(DISPLAYS_WIDE*PANEL_WIDTH*PAGES, DISPLAYS_HIGH*PANEL_HEIGHT);
+
+int page = 0;
+unsigned long count;
+
+// the setup routine runs once when you press reset:
+void setup() {
+  dmd.setBrightness(255);
+  dmd.begin();
+
+  canvas.selectFont(System5x7);
+  canvas.drawString(2, 0, F("Page"));
+  canvas.drawString(2, 8, F("one"));
+  canvas.drawBox(dmd.width, 0, dmd.width * 2 - 1, dmd.height - 1);
+  canvas.drawString(dmd.width * 2 + 2, 0, F("Page"));
+  canvas.drawString(dmd.width * 2 + 2, 8, F("three"));
+
+  dmd.setCanvas(&canvas);
+}
+
+// the loop routine runs over and over again forever:
+void loop() {
+  // Keep the counter on the middle page up to date, even when it's not showing
+  for(int i = 0; i < 20; i++) {
+    canvas.drawString(dmd.width + 2, 4, String(count++ % 10000) + "  ");
+    delay(100);
+  }
+
+  // Pan across to the next page, one pixel at a time
+  int next_page = (page + 1) % PAGES;
+  int step = next_page > page ? 1 : -4;
+  for(int x = page * dmd.width; x != next_page * dmd.width; x += step) {
+    dmd.setViewport(x + step, 0);
+    delay(20);
+  }
+  page = next_page;
+}
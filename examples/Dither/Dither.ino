@@ -0,0 +1,60 @@
+/*
+  Greyscale images on a DMD display, by dithering
+
+  Draws a gradient with each of the dithering methods in turn. Or send an
+  image over the serial port: 8 bit greyscale bytes, one per pixel, left
+  to right and top to bottom (eg the pixel data of a binary PGM file the
+  same size as the display.) Nothing is sent back, and the image is drawn
+  as it arrives.
+ */
+
+#include <SPI.h>
+#include <DMD2.h>
+
+#define DISPLAYS_WIDE 2
+#define DISPLAYS_HIGH 1
+
+SoftDMD dmd(DISPLAYS_WIDE, DISPLAYS_HIGH);
+DMD_Dither *upload;
+
+const DMDDitherMethod METHODS[] = { DITHER_THRESHOLD, DITHER_BAYER, DITHER_FLOYD_STEINBERG };
+int method = 0;
+unsigned long last_change;
+
+// Left to right from off to full brightness, and a ripple of shade from top to bottom
+void drawGradient(DMDDitherMethod method) {
+  DMD_Dither dither(dmd, method);
+  uint8_t row[DISPLAYS_WIDE * PANEL_WIDTH];
+  for(int y = 0; y < dmd.height; y++) {
+    for(int x = 0; x < dmd.width; x++) {
+      int level = x * 255 / (dmd.width - 1) + ((y & 4) ? 16 : -16);
+      row[x] = constrain(level, 0, 255);
+    }
+    dither.writeRow(row);
+  }
+}
+
+// the setup routine runs once when you press reset:
+void setup() {
+  Serial.begin(115200);
+  dmd.setBrightness(255);
+  dmd.begin();
+  upload = new DMD_Dither(dmd, DITHER_FLOYD_STEINBERG);
+}
+
+// the loop routine runs over and over again forever:
+void loop() {
+  if(Serial.available()) {
+    while(Serial.available())
+      upload->write(Serial.read());
+    if(upload->done())
+      upload->restart(); // ready for the next image
+    last_change = millis(); // leave it on the display for a while
+  }
+
+  if(millis() - last_change >= 3000) {
+    last_change = millis();
+    drawGradient(METHODS[method]);
+    method = (method + 1) % 3;
+  }
+}
@@ -3,6 +3,15 @@
 
   Simulates Conway's Game of Life
   https://en.wikipedia.org/wiki/Conway%27s_Game_of_Life
+
+  Each generation is worked out by DMDFrame::stepLife(), which updates 8
+  cells at a time straight from the display's bitmap. Other Life-like
+  rules can be passed to it, eg HighLife (B36/S23):
+
+    dmd.stepLife((1 << 3) | (1 << 6), (1 << 2) | (1 << 3));
+
+  A hash of each generation (DMDFrame::pixelHash()) is kept to spot when
+  the pattern stops changing or starts repeating, and start again.
  */
 
 #include <SPI.h>
@@ -14,6 +23,11 @@ const int HEIGHT = 1;
 
 SoftDMD dmd(WIDTH,HEIGHT);
 
+// Hashes of the last few generations, to spot patterns that repeat
+const int HISTORY = 8;
+uint32_t history[HISTORY];
+int generation = 0;
+
 void populate_random_cells() {
   // Populate the initial display randomly
   for(int x = 0; x < dmd.width; x++) {
@@ -36,48 +50,29 @@ void setup() {
 
 // the loop routine runs over and over again forever:
 void loop() {
-  // Store the current generation by copying the current DMD frame contents
-  DMDFrame current_generation(dmd);
+  long start = micros();
 
-  long start = millis();
+  // Update the display to the next generation
+  dmd.stepLife();
 
-  // Update next generation of every pixel
-  bool change = false;
-  for(int x = 0; x < dmd.width; x++) {
-    for(int y = 0; y < dmd.height; y++) {
-      bool state = current_generation.getPixel(x,y);
-      int live_neighbours = 0;
-
-      // Count how many live neighbours we have in the current generation
-      for(int nx = x - 1; nx < x + 2; nx++) {
-        for(int ny = y - 1; ny < y + 2; ny++) {
-          if(nx == x && ny == y)
-            continue;
-          if(current_generation.getPixel(nx,ny))
-            live_neighbours++;
-        }
-      }
-
-      // Update pixel count for the next generation
-      if(state && (live_neighbours < 2 || live_neighbours > 3)) {
-        state = false;
-        change = true;
-      }
-      else if(!state && (live_neighbours == 3)) {
-        state = true;
-        change = true;
-      }
-      dmd.setPixel(x,y,state ? GRAPHICS_ON : GRAPHICS_OFF);
-    }
-  }
+  Serial.println(String("Generation time: ") + (micros() - start) + " us");
+  delay(50); // (otherwise it's too fast to watch)
 
-  Serial.println(String("Generation time: ") + (millis() - start) + " ms");
+  // If this generation is the same as one of the last few, we've made it to an
+  // unchanging state (or one that changes forward and back)
+  uint32_t hash = dmd.pixelHash();
+  bool repeated = false;
+  for(int i = 0; i < HISTORY && i < generation; i++) {
+    if(history[i] == hash)
+      repeated = true;
+  }
+  history[generation % HISTORY] = hash;
+  generation++;
 
-  if(!change) {
-    // We've made it to an unchanging state
+  if(repeated) {
     delay(500);
+    dmd.clearScreen();
     populate_random_cells();
-    // (We can't detect steady states where things change forward
-    // and back, for these you need to press reset!)
+    generation = 0;
   }
 }
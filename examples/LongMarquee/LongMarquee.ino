@@ -0,0 +1,30 @@
+/*
+  Scroll a long message across a single DMD display
+
+  DMD_TextStrip renders the message once, then each scroll step just copies
+  a window of it onto the display. The message can be much wider than the
+  display without declaring a wider DMD.
+ */
+
+#include <SPI.h>
+#include <DMD2.h>
+#include <fonts/Arial14.h>
+
+SoftDMD dmd(1,1);
+DMD_TextStrip strip(dmd, 0, 1); // strip uses the whole width of the display, from row 1 down
+
+// the setup routine runs once when you press reset:
+void setup() {
+  dmd.setBrightness(255);
+  dmd.selectFont(Arial14);
+  dmd.begin();
+  // Lazy mode only keeps a display width (plus a bit) of the message rendered at a time,
+  // so even very long messages fit in a small amount of RAM.
+  strip.setText(F("This message is far too long to fit on the display all at once, but DMD_TextStrip doesn't mind!"), true);
+}
+
+// the loop routine runs over and over again forever:
+void loop() {
+  strip.scroll(1);
+  delay(30);
+}
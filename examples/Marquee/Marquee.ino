@@ -22,7 +22,8 @@ void setup() {
   dmd.selectFont(Arial14);
   dmd.begin();
   /* TIP: If you want a longer string here than fits on your display, just define the display DISPLAYS_WIDE value to be wider than the
-    number of displays you actually have.
+    number of displays you actually have. (Or see the LongMarquee example, which scrolls long messages
+    without needing a bigger display.)
    */
   dmd.drawString(0, 0, F("Hello World!"));
 }
@@ -0,0 +1,55 @@
+/*
+  Text in a font read from an SD card
+
+  Fonts too big to fit in flash alongside a sketch can be read from an SD
+  card instead. Convert a font with extras/fontbin.py, eg
+
+    python3 extras/fontbin.py fonts/Droid_Sans_24.h
+
+  and copy DROID_SA.FNT to the card. Only a few glyphs at a time are kept
+  in RAM, each one is read from the card the first time it's drawn.
+
+  The SD card shares the SPI bus with the display, so the display isn't
+  scanned while the card's chip select is low (see setOtherCS.)
+ */
+
+#include <SPI.h>
+#include <SD.h>
+#include <DMD2.h>
+#include <DMD2_SDFont.h>
+
+const int SD_CS = 4; // chip select for the SD card, 4 on most Ethernet & SD shields
+
+SPIDMD dmd(2,2);  // 2x2 panels, room for the 24 pixel high font
+DMD_SDFont bigFont("DROID_SA.FNT");
+
+const char *words[] = { "Hello", "from", "the", "card" };
+const int WORD_COUNT = sizeof(words) / sizeof(words[0]);
+int counter = 0;
+
+// the setup routine runs once when you press reset:
+void setup() {
+  Serial.begin(9600);
+  pinMode(SD_CS, OUTPUT);
+  digitalWrite(SD_CS, HIGH);
+  dmd.setOtherCS(SD_CS);
+  dmd.setBrightness(255);
+  dmd.begin();
+
+  if(!SD.begin(SD_CS) || !dmd.selectFont(bigFont)) {
+    Serial.println(F("Couldn't read DROID_SA.FNT from the SD card"));
+    while(1) { }
+  }
+}
+
+// the loop routine runs over and over again forever:
+void loop() {
+  const char *word = words[counter];
+  dmd.clearScreen();
+  dmd.drawString((dmd.width - dmd.stringWidth(word)) / 2, 4, word);
+  counter = (counter + 1) % WORD_COUNT;
+
+  Serial.print(F("Glyphs read from the card so far: "));
+  Serial.println(bigFont.getGlyphReads());
+  delay(1000);
+}
@@ -0,0 +1,32 @@
+/*
+  Frames streamed from a PC over the serial port
+
+  Run extras/dmdstream.py on the PC to send a loop of images, eg
+
+    python3 extras/dmdstream.py /dev/ttyUSB0 1000000 128 16 frame1.pbm frame2.pbm
+
+  Frames are decoded as the bytes arrive into a second frame buffer, then
+  swapped onto the display when they're complete (see DMD_StreamReceiver
+  in DMD2.h for the packet format.) At 1Mbaud a full frame for a 4x1 wall
+  is 263 bytes, so around 380 frames a second fit, more when only part of
+  the display changes and a delta packet is smaller.
+ */
+
+#include <SPI.h>
+#include <DMD2.h>
+
+SPIDMD dmd(4,1);  // 4 panels wide, 1 high
+DMDFrame back(dmd.width, dmd.height); // the next frame is decoded into this
+DMD_StreamReceiver receiver(dmd, back);
+
+// the setup routine runs once when you press reset:
+void setup() {
+  Serial.begin(1000000);
+  dmd.setBrightness(255);
+  dmd.begin();
+}
+
+// the loop routine runs over and over again forever:
+void loop() {
+  receiver.poll(Serial);
+}
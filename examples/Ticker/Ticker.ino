@@ -0,0 +1,42 @@
+/*
+  Two news tickers on one DMD display, running at different speeds
+
+  Anything sent to the Arduino over the serial port is added to the top
+  ticker. DMD_Ticker only renders each column of text as it scrolls on,
+  so there's no limit to how much text can go through it.
+ */
+
+#include <SPI.h>
+#include <DMD2.h>
+#include <fonts/SystemFont5x7.h>
+
+SoftDMD dmd(1,1);
+DMD_Ticker top_ticker(dmd, 0, 0, 32, 8);
+DMD_Ticker bottom_ticker(dmd, 0, 8, 32, 8);
+
+unsigned long count;
+
+// the setup routine runs once when you press reset:
+void setup() {
+  Serial.begin(9600);
+  dmd.setBrightness(255);
+  dmd.selectFont(System5x7);
+  dmd.begin();
+  top_ticker.setSpeed(20);    // pixels per second
+  bottom_ticker.setSpeed(45);
+  top_ticker.print(F("Send me text over serial... ")); // fits in DMD_TICKER_QUEUE
+}
+
+// the loop routine runs over and over again forever:
+void loop() {
+  while(Serial.available() && top_ticker.availableForWrite())
+    top_ticker.write(Serial.read());
+
+  if(bottom_ticker.idle()) {
+    bottom_ticker.print(count++);
+    bottom_ticker.print(F(" bottles of beer... "));
+  }
+
+  top_ticker.update();
+  bottom_ticker.update();
+}
@@ -0,0 +1,71 @@
+/*
+  Several animations at once, without delay()
+
+  A DMD_Timeline steps each animation when it's due, so loop() never
+  waits and anything else the sketch does (here, reading text to scroll
+  from the serial port) carries on between steps. Each tick's changes are
+  shown together, with triple buffering.
+
+  Every few seconds the sketch prints how late the ticker's last update
+  was, in milliseconds. If the loop is held up, the animations catch up
+  with the steps they missed, rather than falling behind.
+ */
+
+#include <SPI.h>
+#include <DMD2.h>
+#include <fonts/SystemFont5x7.h>
+
+SoftDMD dmd(2,1);
+DMDFrame *canvas; // drawn into by the timeline, see beginTripleBuffering()
+DMD_Timeline *timeline;
+DMD_Ticker *ticker;
+int ticker_track;
+
+DMDFrame dot(3,3); // blinks at the top right
+DMDFrame spinner0(8,8), spinner1(8,8), spinner2(8,8), spinner3(8,8);
+DMDFrame *spinner[] = { &spinner0, &spinner1, &spinner2, &spinner3 };
+
+unsigned long last_report;
+
+// the setup routine runs once when you press reset:
+void setup() {
+  Serial.begin(9600);
+  dmd.setBrightness(255);
+  dmd.begin();
+  canvas = dmd.beginTripleBuffering();
+  canvas->selectFont(System5x7);
+  canvas->drawString(0, 0, "DMD2 ");
+
+  dot.fillScreen(true);
+  spinner0.drawLine(3, 0, 3, 7);
+  spinner1.drawLine(0, 7, 7, 0);
+  spinner2.drawLine(0, 3, 7, 3);
+  spinner3.drawLine(0, 0, 7, 7);
+
+  ticker = new DMD_Ticker(*canvas, 0, 8, 64, 8);
+  ticker->print(F("Send me some text over serial... "));
+
+  timeline = new DMD_Timeline(*canvas, &dmd);
+  timeline->addScroll(100, 1, 0, true, 0, 0, 32, 8); // "DMD2" goes round and round
+  timeline->addFrames(150, spinner, 4, 40, 0);
+  timeline->addBlink(500, dot, 60, 2);
+  ticker_track = timeline->addTicker(25, *ticker); // 40 pixels per second
+}
+
+// the loop routine runs over and over again forever:
+void loop() {
+  while(Serial.available() && ticker->availableForWrite())
+    ticker->write(Serial.read());
+
+  unsigned long now = millis();
+  timeline->tick(now);
+
+  if(now - last_report >= 5000) {
+    last_report = now;
+    Serial.print(F("Ticker was "));
+    Serial.print(timeline->getLateness(ticker_track));
+    Serial.print(F("ms late, at most "));
+    Serial.print(timeline->getMaxLateness(ticker_track));
+    Serial.println(F("ms"));
+  }
+}
@@ -0,0 +1,61 @@
+/*
+  Change between messages with wipes, dissolves, pushes and slides
+
+  Each message is drawn into its own frame, then DMD_Transition draws
+  every step from one to the next into the display, at about 60 steps a
+  second.
+ */
+
+#include <SPI.h>
+#include <DMD2.h>
+#include <fonts/Arial14.h>
+
+SoftDMD dmd(2,1);
+DMDFrame current(dmd.width, dmd.height);
+DMDFrame next(dmd.width, dmd.height);
+
+const char *MESSAGES[] = { "Hello", "DMD2", "Freetronics", "Bye!" };
+const int MESSAGE_COUNT = sizeof(MESSAGES) / sizeof(MESSAGES[0]);
+const DMDTransitionEffect EFFECTS[] = {
+  TRANSITION_WIPE_RIGHT, TRANSITION_DISSOLVE, TRANSITION_PUSH_LEFT, TRANSITION_SLIDE_DOWN,
+  TRANSITION_WIPE_UP, TRANSITION_PUSH_UP, TRANSITION_SLIDE_LEFT,
+};
+const int EFFECT_COUNT = sizeof(EFFECTS) / sizeof(EFFECTS[0]);
+
+const int STEPS = 30; // half a second
+const unsigned long STEP_MS = 16;
+
+int message = 0;
+int effect = 0;
+
+void drawMessage(DMDFrame &frame, const char *text) {
+  frame.clearScreen();
+  frame.selectFont(Arial14);
+  frame.drawString((frame.width - frame.stringWidth(text)) / 2, 1, text);
+}
+
+// the setup routine runs once when you press reset:
+void setup() {
+  dmd.setBrightness(255);
+  dmd.begin();
+  drawMessage(current, MESSAGES[0]);
+  dmd.copyFrame(current, 0, 0);
+}
+
+// the loop routine runs over and over again forever:
+void loop() {
+  delay(2000);
+
+  message = (message + 1) % MESSAGE_COUNT;
+  drawMessage(next, MESSAGES[message]);
+  DMD_Transition transition(dmd, current, next, EFFECTS[effect], STEPS);
+  effect = (effect + 1) % EFFECT_COUNT;
+
+  unsigned long due = millis();
+  while(transition.step()) {
+    due += STEP_MS;
+    while((long)(millis() - due) < 0)
+      ;
+  }
+  current.swapBuffers(next);
+}
@@ -0,0 +1,148 @@
+#!/usr/bin/env python3
+"""
+Send frames to a DMD_StreamReceiver (see DMD2.h for the packet format).
+
+Usage: dmdstream.py <port> <baud> <width> <height> <image.pbm> ...
+
+Each image is a PBM file (plain P1 or raw P4) the size of the display.
+The images are sent in a loop, each as the smallest of a full frame, a
+delta rows packet or an RLE delta packet, with a full frame every
+FULL_EVERY frames in case one was lost. Needs pyserial.
+
+The encode functions can also be used from other scripts, eg to send
+frames over a network socket instead.
+"""
+import sys
+import time
+
+SYNC = bytes([0xD2, 0x4D])
+FULL = ord('F')
+DELTA_ROWS = ord('D')
+DELTA_RLE = ord('R')
+FULL_EVERY = 50
+
+
+def crc16(data, crc=0xFFFF):
+    """ CRC16-CCITT, polynomial 0x1021 """
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+            crc &= 0xFFFF
+    return crc
+
+
+def packet(ptype, payload):
+    body = bytes([ptype, len(payload) & 0xFF, len(payload) >> 8]) + bytes(payload)
+    crc = crc16(body)
+    return SYNC + body + bytes([crc & 0xFF, crc >> 8])
+
+
+def encode_full(frame):
+    """ frame is the linear bitmap: rows of (width + 7) // 8 bytes, MSB first, set = on """
+    return packet(FULL, frame)
+
+
+def encode_delta_rows(frame, previous, row_bytes):
+    payload = bytearray()
+    for y in range(len(frame) // row_bytes):
+        row = frame[y * row_bytes:(y + 1) * row_bytes]
+        old = previous[y * row_bytes:(y + 1) * row_bytes]
+        if row != old:
+            payload.append(y)
+            payload += bytes(a ^ b for a, b in zip(row, old))
+    return packet(DELTA_ROWS, payload)
+
+
+def rle(data):
+    """ n < 0x80 then n+1 bytes as they are, or n >= 0x80 then one byte repeated n-0x7E times """
+    out = bytearray()
+    literal = bytearray()
+    i = 0
+    while i < len(data):
+        j = i
+        while j < len(data) and j - i < 129 and data[j] == data[i]:
+            j += 1
+        if j - i >= 3 or (j - i == 2 and not literal):  # (a pair in a literal is no bigger left in it)
+            while literal:
+                out.append(len(literal[:128]) - 1)
+                out += literal[:128]
+                literal = literal[128:]
+            out += bytes([j - i + 0x7E, data[i]])
+            i = j
+        else:
+            literal.append(data[i])
+            i += 1
+    while literal:
+        out.append(len(literal[:128]) - 1)
+        out += literal[:128]
+        literal = literal[128:]
+    return out
+
+
+def encode_delta_rle(frame, previous):
+    delta = bytes(a ^ b for a, b in zip(frame, previous))
+    end = len(delta.rstrip(b'\0'))  # unchanged rows at the end needn't be sent
+    return packet(DELTA_RLE, rle(delta[:end]))
+
+
+def encode(frame, previous, row_bytes):
+    """ Smallest packet to get from the previous frame (None if unknown) to this one """
+    if previous is None:
+        return encode_full(frame)
+    return min(encode_full(frame), encode_delta_rows(frame, previous, row_bytes),
+               encode_delta_rle(frame, previous), key=len)
+
+
+def read_pbm(path, width, height):
+    with open(path, 'rb') as f:
+        data = f.read()
+    fields = []
+    pos = 0
+    while len(fields) < 3:  # magic, width, height (skipping comments)
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b'#':
+            pos = data.index(b'\n', pos)
+            continue
+        start = pos
+        while not data[pos:pos + 1].isspace():
+            pos += 1
+        fields.append(data[start:pos])
+    if (int(fields[1]), int(fields[2])) != (width, height):
+        raise ValueError("%s is %sx%s, not %dx%d" % (path, fields[1].decode(), fields[2].decode(), width, height))
+    row_bytes = (width + 7) // 8
+    if fields[0] == b'P4':
+        return data[pos + 1:pos + 1 + row_bytes * height]
+    bits = [int(c) for c in data[pos:].decode() if c in '01']
+    frame = bytearray(row_bytes * height)
+    for y in range(height):
+        for x in range(width):
+            if bits[y * width + x]:
+                frame[y * row_bytes + x // 8] |= 0x80 >> (x % 8)
+    return bytes(frame)
+
+
+def main(argv):
+    if len(argv) < 6:
+        sys.stderr.write(__doc__)
+        return 1
+    import serial
+    port, baud, width, height = argv[1], int(argv[2]), int(argv[3]), int(argv[4])
+    row_bytes = (width + 7) // 8
+    frames = [read_pbm(path, width, height) for path in argv[5:]]
+    with serial.Serial(port, baud) as ser:
+        time.sleep(2)  # most Arduinos reset when the port is opened
+        previous = None
+        count = 0
+        while True:
+            for frame in frames:
+                if count % FULL_EVERY == 0:
+                    previous = None
+                ser.write(encode(frame, previous, row_bytes))
+                previous = frame
+                count += 1
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
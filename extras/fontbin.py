@@ -0,0 +1,42 @@
+#!/usr/bin/env python3
+"""
+Write a font header (as in the DMD2 fonts/ directory) out as a binary file,
+to be copied to an SD card and read with DMD_SDFont (see DMD2_SDFont.h).
+
+Usage: fontbin.py <font.h> [<output>]
+
+The output defaults to the font's name, truncated to 8 characters to suit
+the 8.3 names used by the SD library, with a .FNT extension (in the current
+directory.) FontCreator fixed and variable width fonts and sparse fonts
+(extras/fontsparse.py) can be read from a file, packed fonts can't.
+"""
+import re
+import sys
+
+from fontpack import read_font
+
+PACKED_SIZE = 0xFFFF
+
+
+def main(argv):
+    if len(argv) < 2 or len(argv) > 3:
+        sys.stderr.write(__doc__)
+        return 1
+    source = argv[1]
+    name, font = read_font(source)
+    if (font[0] << 8 | font[1]) == PACKED_SIZE:
+        sys.stderr.write("%s: packed fonts can't be read from a file, use the original font\n" % source)
+        return 1
+    if len(argv) > 2:
+        output = argv[2]
+    else:
+        base = re.sub(r'\W', '', name).upper()[:8]
+        output = base + ".FNT"
+    with open(output, 'wb') as f:
+        f.write(font)
+    sys.stderr.write("%s: %d bytes\n" % (output, len(font)))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -0,0 +1,181 @@
+#!/usr/bin/env python3
+"""
+Convert a FontCreator font header (as in the DMD2 fonts/ directory) to a
+DMD2 packed font, which usually takes a lot less flash.
+
+Usage: fontpack.py <font.h> [<output.h> [<array name>]]
+
+The output defaults to <font>_Packed.h, with an array named <font>_Packed.
+Sizes of both versions are printed to stderr.
+
+Packed font format (all multi-byte values little endian):
+
+    uint8_t  size[2]      0xFF, 0xFF marks a packed font (FontCreator fonts have the real size here)
+    uint8_t  width        same as FontCreator header
+    uint8_t  height
+    uint8_t  first_char
+    uint8_t  char_count
+    uint8_t  widths[char_count]
+    then for each glyph:
+      uint8_t  top        first row with any pixels set
+      uint8_t  rows       number of rows from 'top' to the last row with any pixels set (0 for a blank glyph)
+      uint8_t  bits[(width * rows + 7) / 8]
+                          'rows' bits for each column, left to right, packed without padding
+                          (least significant bit first, first bit is the top row of the column)
+
+Fonts up to 8 pixels high also pack the blank row below the glyph, which
+DMD2 draws for these fonts.
+"""
+import os
+import re
+import sys
+
+PACKED_SIZE = 0xFFFF
+MAX_HEIGHT = 32
+
+
+def read_font(path):
+    """ Return the name and bytes of the first PROGMEM array in a font header """
+    with open(path) as f:
+        text = f.read()
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    text = re.sub(r'//[^\n]*', '', text)
+    m = re.search(r'uint8_t\s+(\w+)\s*\[\s*\]\s*PROGMEM\s*=\s*\{(.*?)\}', text, re.S)
+    if not m:
+        raise ValueError("%s: no font array found" % path)
+    values = [int(v, 0) for v in m.group(2).replace('\n', ' ').split(',') if v.strip()]
+    return m.group(1), bytes(values)
+
+
+def glyph_columns(data, width, height):
+    """ Decode FontCreator glyph data to one integer per column (bit n = row n),
+    using the same byte layout as DMDFrame::drawGlyph() """
+    nbytes = (height + 7) // 8
+    columns = []
+    for j in range(width):
+        col = 0
+        for i in range(nbytes):
+            offset = i * 8
+            if i == nbytes - 1 and nbytes > 1:
+                offset = height - 8  # last byte is aligned to the bottom of the glyph
+            first_bit = i * 8 - offset
+            last_bit = min(height - offset, 7)
+            b = data[j + i * width]
+            for k in range(first_bit, last_bit + 1):
+                if b & (1 << k):
+                    col |= 1 << (offset + k)
+        columns.append(col)
+    return columns
+
+
+def pack_glyph(columns):
+    used = 0
+    for col in columns:
+        used |= col
+    if not used:
+        return bytes([0, 0])
+    top = (used & -used).bit_length() - 1
+    rows = used.bit_length() - top
+    bits = 0
+    nbits = 0
+    for col in columns:
+        bits |= (col >> top) << nbits
+        nbits += rows
+    return bytes([top, rows]) + bits.to_bytes((nbits + 7) // 8, 'little')
+
+
+def pack_font(font):
+    fixed_width, height, first_char, char_count = font[2:6]
+    size = (font[0] << 8) | font[1]
+    if height > MAX_HEIGHT:
+        raise ValueError("fonts taller than %d pixels can't be packed" % MAX_HEIGHT)
+    nbytes = (height + 7) // 8
+    if size == 0:  # fixed width font, no widths table
+        widths = [fixed_width] * char_count
+        index = 6
+    else:
+        widths = list(font[6:6 + char_count])
+        index = 6 + char_count
+
+    out = bytearray([0xFF, 0xFF, fixed_width, height, first_char, char_count])
+    out += bytes(widths)
+    glyphs = []
+    for c, w in enumerate(widths):
+        data = font[index:index + w * nbytes]
+        index += w * nbytes
+        glyphs.append(pack_glyph(glyph_columns(data, w, height)))
+    for g in glyphs:
+        out += g
+    return bytes(out), glyphs
+
+
+def write_header(path, name, source, packed, glyphs, original_size):
+    guard = re.sub(r'\W', '_', os.path.basename(path)).upper()
+    fixed_width, height, first_char, char_count = packed[2:6]
+    with open(path, 'w') as f:
+        f.write("""
+
+/*
+ *
+ * %s
+ *
+ * DMD2 packed font, converted from %s by extras/fontpack.py
+ * (see there for the format)
+ *
+ * Font size in bytes  : %d (%d unpacked)
+ * Font width          : %d
+ * Font height         : %d
+ * Font first char     : %d
+ * Font used chars     : %d
+ */
+
+#include <inttypes.h>
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#elif defined (ESP8266)
+#include <pgmspace.h>
+#else
+#define PROGMEM
+#endif
+
+#ifndef %s
+#define %s
+
+static const uint8_t %s[] PROGMEM = {
+    0xFF, 0xFF, // packed font
+    0x%02X, // width
+    0x%02X, // height
+    0x%02X, // first char
+    0x%02X, // char count
+
+    // char widths
+""" % (name, os.path.basename(source), len(packed), original_size, fixed_width, height,
+       first_char, char_count, guard, guard, name, fixed_width, height, first_char, char_count))
+        widths = packed[6:6 + char_count]
+        for i in range(0, len(widths), 10):
+            f.write("    " + ", ".join("0x%02X" % b for b in widths[i:i + 10]) + ",\n")
+        f.write("\n    // glyphs: top row, rows, column bits\n")
+        for c, g in enumerate(glyphs):
+            last = (c == len(glyphs) - 1)
+            f.write("    " + ", ".join("0x%02X" % b for b in g) + ("" if last else ",") + " // %d\n" % (first_char + c))
+        f.write("\n};\n\n#endif\n")
+
+
+def main(argv):
+    if len(argv) < 2 or len(argv) > 4:
+        sys.stderr.write(__doc__)
+        return 1
+    source = argv[1]
+    base = os.path.splitext(os.path.basename(source))[0]
+    output = argv[2] if len(argv) > 2 else os.path.join(os.path.dirname(source), base + "_Packed.h")
+    name, font = read_font(source)
+    name = argv[3] if len(argv) > 3 else name + "_Packed"
+    packed, glyphs = pack_font(font)
+    write_header(output, name, source, packed, glyphs, len(font))
+    sys.stderr.write("%s: %d bytes, %s: %d bytes (%d%%)\n" % (source, len(font), output, len(packed),
+                                                           100 * len(packed) // len(font)))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -0,0 +1,189 @@
+#!/usr/bin/env python3
+"""
+Combine one or more FontCreator font headers (as in the DMD2 fonts/
+directory) into a DMD2 sparse font, which can hold any characters up to
+U+FFFF without storing the gaps between them. Text drawn in a sparse font
+is read as UTF-8.
+
+Usage: fontsparse.py <output.h> <array name> <font.h>[:<encoding>] ...
+
+Each font's character codes are read in the given Python encoding
+(default latin-1, so a font with characters 0xA0-0xFF gives U+00A0-U+00FF,
+and eg cp1251 maps a Cyrillic font to U+0400-U+045F.) Characters with no
+width are left out, and where fonts have the same character the first one
+wins. All the fonts must be the same height. The space width comes from
+the first font.
+
+Sparse font format (all multi-byte values little endian):
+
+    uint8_t  size[2]      0xFE, 0xFE marks a sparse font (FontCreator fonts have the real size here)
+    uint8_t  width        width of a space
+    uint8_t  height       same as FontCreator header
+    uint8_t  first_char   unused (0)
+    uint8_t  range_count
+    range_count ranges of consecutive characters, in order:
+      uint16_t first      first character in the range
+      uint8_t  count      number of characters in the range
+      uint16_t entry      glyph entry of the first character in the range
+    an entry for each glyph, in character order:
+      uint8_t  width
+      uint16_t offset     offset of the glyph data from the start of the font
+    glyph data, same layout as FontCreator fonts
+"""
+import os
+import re
+import sys
+
+from fontpack import read_font
+
+SPARSE_SIZE = 0xFEFE
+MAX_RANGE = 255
+
+
+def font_glyphs(font, encoding):
+    """ Return the space width, height and a {codepoint: (width, data)} dict for a FontCreator font """
+    fixed_width, height, first_char, char_count = font[2:6]
+    size = (font[0] << 8) | font[1]
+    nbytes = (height + 7) // 8
+    if size == 0:  # fixed width font, no widths table
+        widths = [fixed_width] * char_count
+        index = 6
+    else:
+        widths = list(font[6:6 + char_count])
+        index = 6 + char_count
+    glyphs = {}
+    for c, w in enumerate(widths):
+        data = font[index:index + w * nbytes]
+        index += w * nbytes
+        try:
+            codepoint = ord(bytes([first_char + c]).decode(encoding))
+        except (UnicodeDecodeError, ValueError):
+            continue
+        if w and codepoint != 0x20:
+            glyphs[codepoint] = (w, data)
+    return fixed_width, height, glyphs
+
+
+def make_ranges(codepoints):
+    ranges = []
+    for cp in codepoints:
+        if ranges and ranges[-1][0] + ranges[-1][1] == cp and ranges[-1][1] < MAX_RANGE:
+            ranges[-1][1] += 1
+        else:
+            ranges.append([cp, 1])
+    return ranges
+
+
+def sparse_font(space_width, height, glyphs):
+    codepoints = sorted(glyphs)
+    if codepoints and codepoints[-1] >= 0xFFFF:
+        raise ValueError("characters above U+FFFE aren't supported")
+    ranges = make_ranges(codepoints)
+    if len(ranges) > 255:
+        raise ValueError("too many ranges of characters (%d, the most is 255)" % len(ranges))
+
+    out = bytearray([0xFE, 0xFE, space_width, height, 0, len(ranges)])
+    entry = 0
+    for first, count in ranges:
+        out += bytes([first & 0xFF, first >> 8, count, entry & 0xFF, entry >> 8])
+        entry += count
+    offset = len(out) + 3 * len(codepoints)
+    for cp in codepoints:
+        w, data = glyphs[cp]
+        out += bytes([w, offset & 0xFF, offset >> 8])
+        offset += len(data)
+    for cp in codepoints:
+        out += glyphs[cp][1]
+    if len(out) > 0xFFFF:
+        raise ValueError("font is too big (%d bytes, the most is 65535)" % len(out))
+    return bytes(out), ranges, codepoints
+
+
+def hexbytes(data):
+    return ", ".join("0x%02X" % b for b in data)
+
+
+def write_header(path, name, sources, font, ranges, codepoints, glyphs):
+    guard = re.sub(r'\W', '_', os.path.basename(path)).upper()
+    space_width, height = font[2:4]
+    with open(path, 'w', encoding='utf-8') as f:
+        f.write("""
+
+/*
+ *
+ * %s
+ *
+ * DMD2 sparse font, made from %s by extras/fontsparse.py
+ * (see there for the format)
+ *
+ * Font size in bytes  : %d
+ * Font height         : %d
+ * Font used chars     : %d, in %d ranges
+ */
+
+#include <inttypes.h>
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#elif defined (ESP8266)
+#include <pgmspace.h>
+#else
+#define PROGMEM
+#endif
+
+#ifndef %s
+#define %s
+
+static const uint8_t %s[] PROGMEM = {
+    0xFE, 0xFE, // sparse font
+    0x%02X, // space width
+    0x%02X, // height
+    0x00, // (unused)
+    0x%02X, // range count
+
+    // ranges: first char, char count, first glyph
+""" % (name, ", ".join(sources), len(font), height, len(codepoints), len(ranges),
+       guard, guard, name, space_width, height, len(ranges)))
+        index = 6
+        for first, count in ranges:
+            f.write("    %s, // U+%04X-U+%04X\n" % (hexbytes(font[index:index + 5]), first, first + count - 1))
+            index += 5
+        f.write("\n    // glyphs: width, data offset\n")
+        for i in range(0, len(codepoints), 4):
+            chunk = font[index + i * 3:index + min(i + 4, len(codepoints)) * 3]
+            f.write("    " + hexbytes(chunk) + ", // U+%04X\n" % codepoints[i])
+        f.write("\n    // glyph data\n")
+        for n, cp in enumerate(codepoints):
+            last = (n == len(codepoints) - 1)
+            shown = chr(cp) if cp > 0x20 and chr(cp).isprintable() and cp != 0x5C else ''
+            f.write("    " + hexbytes(glyphs[cp][1]) + ("" if last else ",") +
+                    " // U+%04X %s\n" % (cp, shown))
+        f.write("\n};\n\n#endif\n")
+
+
+def main(argv):
+    if len(argv) < 4:
+        sys.stderr.write(__doc__)
+        return 1
+    output, name = argv[1:3]
+    space_width = height = None
+    glyphs = {}
+    sources = []
+    for arg in argv[3:]:
+        path, _, encoding = arg.partition(':')
+        _, font = read_font(path)
+        w, h, new_glyphs = font_glyphs(font, encoding or 'latin-1')
+        if height is None:
+            space_width, height = w, h
+        elif h != height:
+            raise ValueError("%s is %d pixels high, not %d" % (path, h, height))
+        for cp, g in new_glyphs.items():
+            glyphs.setdefault(cp, g)
+        sources.append(os.path.basename(path))
+    font, ranges, codepoints = sparse_font(space_width, height, glyphs)
+    write_header(output, name, sources, font, ranges, codepoints, glyphs)
+    sys.stderr.write("%s: %d characters in %d ranges, %d bytes\n" % (output, len(codepoints), len(ranges), len(font)))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
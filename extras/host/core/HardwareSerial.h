@@ -0,0 +1,41 @@
+/*
+ Mock Arduino serial port for the DMD2 host build
+
+ Serial writes to stdout and reads from stdin.
+
+ Copyright (C) 2014 Freetronics, Inc. (info <at> freetronics <dot> com)
+
+---
+
+ This program is free software: you can redistribute it and/or modify it under the terms
+ of the version 3 GNU General Public License as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program.
+ If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef HARDWARESERIAL_H
+#define HARDWARESERIAL_H
+
+#include "Stream.h"
+
+class HardwareSerial : public Stream
+{
+public:
+  void begin(unsigned long baud) { (void)baud; }
+  void end() {}
+  virtual size_t write(uint8_t c);
+  using Print::write;
+  virtual int available();
+  virtual int read();
+  virtual int peek();
+  virtual void flush();
+  operator bool() { return true; }
+};
+
+extern HardwareSerial Serial;
+
+#endif
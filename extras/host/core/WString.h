@@ -0,0 +1,54 @@
+/*
+ Mock Arduino String class for the DMD2 host build
+
+ Copyright (C) 2014 Freetronics, Inc. (info <at> freetronics <dot> com)
+
+---
+
+ This program is free software: you can redistribute it and/or modify it under the terms
+ of the version 3 GNU General Public License as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program.
+ If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef WSTRING_H
+#define WSTRING_H
+
+#include <string>
+
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper *>(string_literal))
+
+class String
+{
+public:
+  String(const char *cstr = "") : s(cstr ? cstr : "") {}
+  String(const String &other) : s(other.s) {}
+  explicit String(char c) : s(1, c) {}
+  explicit String(int value) : s(std::to_string(value)) {}
+  explicit String(long value) : s(std::to_string(value)) {}
+  explicit String(unsigned int value) : s(std::to_string(value)) {}
+  explicit String(unsigned long value) : s(std::to_string(value)) {}
+
+  String &operator=(const String &other) { s = other.s; return *this; }
+  String &operator+=(const String &other) { s += other.s; return *this; }
+  String &operator+=(const char *cstr) { s += cstr; return *this; }
+  String &operator+=(char c) { s += c; return *this; }
+  friend String operator+(const String &a, const String &b) { String r(a); r += b; return r; }
+  bool operator==(const String &other) const { return s == other.s; }
+  bool operator!=(const String &other) const { return s != other.s; }
+
+  char operator[](unsigned int index) const { return index < s.size() ? s[index] : 0; }
+  char charAt(unsigned int index) const { return (*this)[index]; }
+  unsigned int length() const { return s.size(); }
+  const char *c_str() const { return s.c_str(); }
+
+private:
+  std::string s;
+};
+
+#endif
@@ -0,0 +1,347 @@
+/*
+ Mock Arduino core for building DMD2 on a Linux host
+
+ Copyright (C) 2014 Freetronics, Inc. (info <at> freetronics <dot> com)
+
+---
+
+ This program is free software: you can redistribute it and/or modify it under the terms
+ of the version 3 GNU General Public License as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program.
+ If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "Arduino.h"
+#include "SPI.h"
+#include "host.h"
+#include <stdio.h>
+#include <time.h>
+#include <poll.h>
+#include <unistd.h>
+#include <malloc.h>
+#include <new>
+
+/* Clock */
+
+static bool simulated_clock = false;
+static unsigned long simulated_micros;
+
+static unsigned long realMicros()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (unsigned long)ts.tv_sec * 1000000UL + ts.tv_nsec / 1000;
+}
+
+unsigned long micros()
+{
+  return simulated_clock ? simulated_micros : realMicros();
+}
+
+unsigned long millis()
+{
+  return micros() / 1000;
+}
+
+void delay(unsigned long ms)
+{
+  delayMicroseconds(ms * 1000);
+}
+
+void delayMicroseconds(unsigned int us)
+{
+  if(simulated_clock) {
+    simulated_micros += us;
+    return;
+  }
+  struct timespec ts = { (time_t)(us / 1000000), (long)(us % 1000000) * 1000 };
+  nanosleep(&ts, NULL);
+}
+
+void host_setMicros(unsigned long now)
+{
+  simulated_clock = true;
+  simulated_micros = now;
+}
+
+void host_advanceMicros(unsigned long us)
+{
+  host_setMicros(micros() + us);
+}
+
+/* Pins */
+
+intptr_t host_port_registers[HOST_PINS];
+static int8_t input_levels[HOST_PINS];
+static bool inputs_set[HOST_PINS];
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+  (void)pin;
+  (void)mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+  if(pin < HOST_PINS)
+    host_port_registers[pin] = value ? 1 : 0;
+}
+
+int digitalRead(uint8_t pin)
+{
+  if(pin >= HOST_PINS)
+    return LOW;
+  return inputs_set[pin] ? input_levels[pin] : HIGH;
+}
+
+void analogWrite(uint8_t pin, int value)
+{
+  if(pin < HOST_PINS)
+    host_port_registers[pin] = value;
+}
+
+void host_setInput(uint8_t pin, int level)
+{
+  if(pin >= HOST_PINS)
+    return;
+  inputs_set[pin] = true;
+  input_levels[pin] = level ? HIGH : LOW;
+}
+
+int host_getOutput(uint8_t pin)
+{
+  return (pin < HOST_PINS) ? host_port_registers[pin] : 0;
+}
+
+/* SPI */
+
+SPIClass SPI;
+static unsigned long spi_bytes;
+
+uint8_t SPIClass::transfer(uint8_t data)
+{
+  (void)data;
+  spi_bytes++;
+  return 0;
+}
+
+unsigned long host_getSPIBytes()
+{
+  return spi_bytes;
+}
+
+/* Random numbers */
+
+void randomSeed(unsigned long seed)
+{
+  srand(seed);
+}
+
+long random(long howbig)
+{
+  return howbig > 0 ? rand() % howbig : 0;
+}
+
+long random(long howsmall, long howbig)
+{
+  return howsmall < howbig ? howsmall + random(howbig - howsmall) : howsmall;
+}
+
+/* Print */
+
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+  size_t n = 0;
+  while(size--) {
+    if(!write(*buffer++))
+      break;
+    n++;
+  }
+  return n;
+}
+
+size_t Print::print(long n, int base)
+{
+  if(base == DEC) {
+    char buf[24];
+    snprintf(buf, sizeof(buf), "%ld", n);
+    return write(buf);
+  }
+  return print((unsigned long)n, base);
+}
+
+size_t Print::print(unsigned long n, int base)
+{
+  char buf[8 * sizeof(long) + 1];
+  char *str = &buf[sizeof(buf) - 1];
+  *str = 0;
+  if(base < 2)
+    base = DEC;
+  do {
+    char digit = n % base;
+    n /= base;
+    *--str = digit < 10 ? digit + '0' : digit + 'A' - 10;
+  } while(n);
+  return write(str);
+}
+
+size_t Print::print(double n, int digits)
+{
+  char buf[40];
+  snprintf(buf, sizeof(buf), "%.*f", digits, n);
+  return write(buf);
+}
+
+/* Serial, on stdout and stdin */
+
+HardwareSerial Serial;
+static int serial_peeked = -1;
+
+size_t HardwareSerial::write(uint8_t c)
+{
+  return putchar(c) == EOF ? 0 : 1;
+}
+
+int HardwareSerial::available()
+{
+  if(serial_peeked >= 0)
+    return 1;
+  struct pollfd fd = { 0, POLLIN, 0 };
+  return (poll(&fd, 1, 0) == 1 && (fd.revents & POLLIN)) ? 1 : 0;
+}
+
+int HardwareSerial::peek()
+{
+  if(serial_peeked < 0 && available()) {
+    uint8_t c;
+    if(::read(0, &c, 1) == 1)
+      serial_peeked = c;
+  }
+  return serial_peeked;
+}
+
+int HardwareSerial::read()
+{
+  int c = peek();
+  serial_peeked = -1;
+  return c;
+}
+
+void HardwareSerial::flush()
+{
+  fflush(stdout);
+}
+
+/* Heap accounting. The C allocator is wrapped at link time, new and delete go through it. */
+
+static size_t heap_in_use;
+static size_t heap_peak;
+static unsigned long heap_allocations;
+
+extern "C" {
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+void __real_free(void *ptr);
+void __wrap_free(void *ptr);
+
+static void *counted(void *ptr)
+{
+  if(ptr) {
+    heap_allocations++;
+    heap_in_use += malloc_usable_size(ptr);
+    if(heap_in_use > heap_peak)
+      heap_peak = heap_in_use;
+  }
+  return ptr;
+}
+
+void *__wrap_malloc(size_t size)
+{
+  return counted(__real_malloc(size));
+}
+
+void *__wrap_calloc(size_t count, size_t size)
+{
+  return counted(__real_calloc(count, size));
+}
+
+void *__wrap_realloc(void *ptr, size_t size)
+{
+  if(!ptr)
+    return __wrap_malloc(size);
+  if(!size) {
+    __wrap_free(ptr);
+    return NULL;
+  }
+  size_t old_size = malloc_usable_size(ptr);
+  void *res = __real_realloc(ptr, size);
+  if(res)
+    heap_in_use -= old_size; // (if it failed the old block is still there)
+  return counted(res);
+}
+
+void __wrap_free(void *ptr)
+{
+  if(ptr)
+    heap_in_use -= malloc_usable_size(ptr);
+  __real_free(ptr);
+}
+}
+
+void *operator new(size_t size)
+{
+  void *res = malloc(size ? size : 1);
+  if(!res)
+    throw std::bad_alloc();
+  return res;
+}
+
+void *operator new[](size_t size)
+{
+  return operator new(size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+  free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+  free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept
+{
+  free(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept
+{
+  free(ptr);
+}
+
+size_t host_getHeapInUse()
+{
+  return heap_in_use;
+}
+
+size_t host_getHeapPeak()
+{
+  return heap_peak;
+}
+
+void host_resetHeapPeak()
+{
+  heap_peak = heap_in_use;
+}
+
+unsigned long host_getHeapAllocations()
+{
+  return heap_allocations;
+}
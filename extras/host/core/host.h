@@ -0,0 +1,46 @@
+/*
+ Controls for the simulated hardware in the DMD2 host build
+
+ For tests and benchmarks, none of this exists on a real board.
+
+ Copyright (C) 2014 Freetronics, Inc. (info <at> freetronics <dot> com)
+
+---
+
+ This program is free software: you can redistribute it and/or modify it under the terms
+ of the version 3 GNU General Public License as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program.
+ If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef HOST_H
+#define HOST_H
+
+#include "Arduino.h"
+
+/* Clock. micros() and millis() follow the real (monotonic) clock until
+   host_setMicros() is called, then they only move when they're set or
+   advanced, or by delay()/delayMicroseconds(). */
+void host_setMicros(unsigned long now);
+void host_advanceMicros(unsigned long us);
+
+// Pins. Inputs read HIGH unless set otherwise, outputs read back the last value written.
+const uint8_t HOST_PINS = 64;
+void host_setInput(uint8_t pin, int level);
+int host_getOutput(uint8_t pin);
+
+// Number of bytes sent with SPI.transfer()
+unsigned long host_getSPIBytes();
+
+/* Heap accounting. Every malloc/calloc/realloc/new in the program is
+   counted (the host Makefile links with --wrap for the C allocator.) */
+size_t host_getHeapInUse();
+size_t host_getHeapPeak();
+void host_resetHeapPeak(); // peak starts again from what's in use now
+unsigned long host_getHeapAllocations();
+
+#endif
@@ -0,0 +1,34 @@
+/*
+ main() for running an Arduino sketch on the host
+
+ Calls setup() then loop(), forever or for the number of times given
+ as the first argument.
+
+ Copyright (C) 2014 Freetronics, Inc. (info <at> freetronics <dot> com)
+
+---
+
+ This program is free software: you can redistribute it and/or modify it under the terms
+ of the version 3 GNU General Public License as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program.
+ If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "Arduino.h"
+
+void setup();
+void loop();
+
+int main(int argc, char **argv)
+{
+  long loops = (argc > 1) ? atol(argv[1]) : -1;
+  setup();
+  while(loops < 0 || loops-- > 0)
+    loop();
+  Serial.flush();
+  return 0;
+}
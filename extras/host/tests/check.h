@@ -0,0 +1,52 @@
+/*
+ Minimal checks for the DMD2 host tests
+
+ Each test is a program which exits with a non-zero status if any
+ CHECK() failed. Test data files are opened relative to tests/.
+
+ Copyright (C) 2014 Freetronics, Inc. (info <at> freetronics <dot> com)
+
+---
+
+ This program is free software: you can redistribute it and/or modify it under the terms
+ of the version 3 GNU General Public License as published by the Free Software Foundation.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ See the GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License along with this program.
+ If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef CHECK_H
+#define CHECK_H
+
+#include <stdio.h>
+
+static unsigned int check_failures = 0;
+
+#define CHECK(condition) do {                                           \
+    if(!(condition)) {                                                  \
+      check_failures++;                                                 \
+      fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+    }                                                                   \
+  } while(0)
+
+#define CHECK_EQUAL(actual, expected) do {                              \
+    long long check_actual = (actual), check_expected = (expected);    \
+    if(check_actual != check_expected) {                                \
+      check_failures++;                                                 \
+      fprintf(stderr, "%s:%d: check failed: %s is %lld, expected %lld\n", \
+              __FILE__, __LINE__, #actual, check_actual, check_expected); \
+    }                                                                   \
+  } while(0)
+
+// Return this from main()
+static inline int checkResult()
+{
+  if(check_failures)
+    fprintf(stderr, "%u checks failed\n", check_failures);
+  return check_failures ? 1 : 0;
+}
+
+#endif
@@ -0,0 +1,47 @@
+#!/usr/bin/env python3
+"""
+Encode frames with extras/dmdstream.py, for test_stream_receiver.
+
+Usage: stream_encode.py <frames> <width> <height> <output>
+
+<frames> holds the frames one after another in the linear format. Each
+one is sent as a full frame, delta rows, an RLE delta and the smallest of
+those in turn (the first is always a full frame.)
+"""
+import os
+import sys
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..'))
+import dmdstream
+
+
+def main(argv):
+    if len(argv) != 5:
+        sys.stderr.write(__doc__)
+        return 1
+    width, height = int(argv[2]), int(argv[3])
+    row_bytes = (width + 7) // 8
+    size = row_bytes * height
+    with open(argv[1], 'rb') as f:
+        data = f.read()
+    frames = [data[i:i + size] for i in range(0, len(data), size)]
+    stream = bytearray()
+    previous = None
+    for i, frame in enumerate(frames):
+        kind = i % 4
+        if previous is None or kind == 0:
+            stream += dmdstream.encode_full(frame)
+        elif kind == 1:
+            stream += dmdstream.encode_delta_rows(frame, previous, row_bytes)
+        elif kind == 2:
+            stream += dmdstream.encode_delta_rle(frame, previous)
+        else:
+            stream += dmdstream.encode(frame, previous, row_bytes)
+        previous = frame
+    with open(argv[4], 'wb') as f:
+        f.write(stream)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -0,0 +1,175 @@
+/*
+ Host tests for DMD_CachedFont, reading fonts written by extras/fontbin.py (needs python3)
+ from files, as DMD_SDFont does from an SD card
+*/
+#include "DMD2.h"
+#include "host.h"
+#include "check.h"
+#include <stdio.h>
+#include <fonts/Arial14.h>
+#include <fonts/SystemFont5x7.h>
+#include <fonts/SystemFont5x7_Extended.h>
+
+class FileFont : public DMD_CachedFont {
+public:
+  FileFont(const char *path, uint8_t cacheGlyphs) : DMD_CachedFont(cacheGlyphs), reads(0) {
+    file = fopen(path, "rb");
+  }
+  ~FileFont() {
+    if(file)
+      fclose(file);
+  }
+
+protected:
+  bool readAt(uint32_t position, uint8_t *buf, uint16_t length) {
+    reads++;
+    if(!file || fseek(file, position, SEEK_SET))
+      return false;
+    return fread(buf, 1, length, file) == length;
+  }
+
+public:
+  unsigned int reads; // calls to readAt()
+private:
+  FILE *file;
+};
+
+static bool writeFontFile(const char *header, const char *path)
+{
+  char command[128];
+  snprintf(command, sizeof(command), "python3 ../../fontbin.py ../../../fonts/%s %s", header, path);
+  return system(command) == 0;
+}
+
+static unsigned int differences(DMDFrame &a, DMDFrame &b)
+{
+  unsigned int count = 0;
+  for(unsigned int y = 0; y < a.height; y++)
+    for(unsigned int x = 0; x < a.width; x++)
+      count += a.getPixel(x, y) != b.getPixel(x, y);
+  return count;
+}
+
+/* Text drawn from the file is the same, pixel for pixel, as text drawn from the PROGMEM font,
+   however few glyphs fit in the cache */
+static void testSameAsProgmem(const char *header, const uint8_t *font)
+{
+  const char *path = "cached_font.tmp";
+  CHECK(writeFontFile(header, path));
+  const char *text = "The quick brown fox jumps over 13 lazy dogs! {}~";
+  static const uint8_t cache_sizes[] = { 1, 3, 8 };
+  for(unsigned int i = 0; i < sizeof(cache_sizes); i++) {
+    FileFont file_font(path, cache_sizes[i]);
+    DMDFrame expected(255, 20), actual(255, 20);
+    expected.selectFont(font);
+    CHECK(actual.selectFont(file_font));
+    CHECK_EQUAL(actual.stringWidth(text), expected.stringWidth(text));
+    expected.drawString(-2, 1, text);
+    actual.drawString(-2, 1, text);
+    CHECK_EQUAL(differences(expected, actual), 0);
+
+    // Wrapped onto several lines by a text box, which measures and draws glyphs separately
+    expected.clearScreen();
+    actual.clearScreen();
+    DMD_TextBox expected_box(expected, 0, 0, 60, 20), actual_box(actual, 0, 0, 60, 20);
+    expected_box.print(text);
+    actual_box.print(text);
+    CHECK_EQUAL(differences(expected, actual), 0);
+  }
+  remove(path);
+}
+
+// Glyphs read into a full cache replace the least recently used one
+static void testLeastRecentlyUsed()
+{
+  const char *path = "cached_font.tmp";
+  CHECK(writeFontFile("Arial14.h", path));
+  FileFont font(path, 3);
+  FontHeader header;
+  CHECK(font.begin(header));
+  uint8_t width;
+  CHECK(font.glyphData('A', width) != NULL);
+  CHECK(font.glyphData('B', width) != NULL);
+  CHECK(font.glyphData('C', width) != NULL);
+  CHECK_EQUAL(font.getGlyphReads(), 3);
+  CHECK(font.glyphData('A', width) != NULL); // cached, now B is least recently used
+  CHECK_EQUAL(font.getGlyphReads(), 3);
+  CHECK(font.charWidth('Z') > 0); // widths don't need the glyph read
+  CHECK_EQUAL(font.getGlyphReads(), 3);
+
+  CHECK(font.glyphData('D', width) != NULL); // replaces B
+  CHECK_EQUAL(font.getGlyphReads(), 4);
+  font.glyphData('A', width);
+  font.glyphData('C', width);
+  font.glyphData('D', width);
+  CHECK_EQUAL(font.getGlyphReads(), 4);
+  font.glyphData('B', width); // replaces A
+  CHECK_EQUAL(font.getGlyphReads(), 5);
+  font.glyphData('A', width);
+  CHECK_EQUAL(font.getGlyphReads(), 6);
+
+  // Characters that aren't in the font aren't read
+  CHECK(font.glyphData(0x7F + 20, width) == NULL);
+  CHECK_EQUAL(font.getGlyphReads(), 6);
+  remove(path);
+}
+
+/* Looking up a glyph in a sparse font reads its table entry, which charWidth() keeps in the
+   cache, so measuring then drawing a character reads the file twice rather than three times */
+static void testSparseReads()
+{
+  const char *path = "cached_font.tmp";
+  CHECK(writeFontFile("SystemFont5x7_Extended.h", path));
+  FileFont font(path, 3);
+  DMDFrame frame(32, 16);
+  CHECK(frame.selectFont(font));
+  unsigned int reads = font.reads;
+  CHECK_EQUAL(frame.charWidth('A'), 5);
+  CHECK_EQUAL(font.reads, reads + 1); // table entry
+  frame.drawChar(0, 0, 'A');
+  CHECK_EQUAL(font.reads, reads + 2); // glyph data
+  CHECK_EQUAL(frame.charWidth('A'), 5);
+  frame.drawChar(6, 0, 'A');
+  CHECK_EQUAL(font.reads, reads + 2); // all cached
+  frame.drawChar(12, 0, 'B');
+  CHECK_EQUAL(font.reads, reads + 4);
+  CHECK_EQUAL(font.getGlyphReads(), 2);
+
+  // Widths alone fill the cache, and push out the least recently used glyph
+  reads = font.reads;
+  CHECK(frame.charWidth('C') > 0);
+  CHECK(frame.charWidth('D') > 0); // replaces A
+  CHECK_EQUAL(font.reads, reads + 2);
+  frame.drawChar(0, 8, 'B');
+  frame.drawChar(6, 8, 'C');
+  CHECK_EQUAL(font.reads, reads + 3);
+  frame.drawChar(12, 8, 'A');
+  CHECK_EQUAL(font.reads, reads + 5);
+  remove(path);
+}
+
+// A missing or short file can't be selected
+static void testMissingFile()
+{
+  FileFont missing("no_such_font.tmp", 8);
+  DMDFrame frame(32, 16);
+  CHECK(!frame.selectFont(missing));
+
+  FILE *f = fopen("cached_font.tmp", "wb");
+  fputc(0, f);
+  fclose(f);
+  FileFont truncated("cached_font.tmp", 8);
+  CHECK(!frame.selectFont(truncated));
+  remove("cached_font.tmp");
+}
+
+int main()
+{
+  testSameAsProgmem("Arial14.h", Arial14);
+  testSameAsProgmem("SystemFont5x7.h", SystemFont5x7); // fixed width
+  testSameAsProgmem("SystemFont5x7_Extended.h", SystemFont5x7_Extended); // sparse
+  testLeastRecentlyUsed();
+  testSparseReads();
+  testMissingFile();
+  return checkResult();
+}
@@ -0,0 +1,107 @@
+/*
+ Host tests for frame comparison, pixelHash() and countPixelsOn()
+*/
+#include "DMD2.h"
+#include "host.h"
+#include "check.h"
+
+const uint32_t FNV_PRIME = 16777619UL;
+
+// FNV-1a of the frame's rows as bytes, bits set = off, built from getPixel()
+static uint32_t referenceHash(DMDFrame &frame)
+{
+  uint32_t hash = DMD_HASH_START;
+  for(unsigned int y = 0; y < frame.height; y++) {
+    for(unsigned int x = 0; x < frame.width; x += 8) {
+      uint8_t byte = 0xFF;
+      for(unsigned int bit = 0; bit < 8 && x + bit < frame.width; bit++) {
+        if(frame.getPixel(x + bit, y))
+          byte &= ~(0x80 >> bit);
+      }
+      hash = (hash ^ byte) * FNV_PRIME;
+    }
+  }
+  return hash;
+}
+
+static void randomPixels(DMDFrame &frame, int percent)
+{
+  for(unsigned int y = 0; y < frame.height; y++)
+    for(unsigned int x = 0; x < frame.width; x++)
+      frame.setPixel(x, y, random(100) < percent ? GRAPHICS_ON : GRAPHICS_OFF);
+}
+
+static void testHash()
+{
+  static const byte sizes[][2] = { { 32, 16 }, { 64, 16 }, { 64, 32 }, { 40, 32 }, { 13, 5 } };
+  for(unsigned int s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+    DMDFrame frame(sizes[s][0], sizes[s][1]);
+    CHECK_EQUAL(frame.pixelHash(), referenceHash(frame));
+    for(int i = 0; i < 20; i++) {
+      randomPixels(frame, 30);
+      CHECK_EQUAL(frame.pixelHash(), referenceHash(frame));
+    }
+    frame.setRingRows(true);
+    frame.scrollY(3);
+    CHECK_EQUAL(frame.pixelHash(), referenceHash(frame));
+  }
+}
+
+// Regression: hashing a 32-bit word at a time gave these the same hash as the empty frame
+static void testHashCollisions()
+{
+  DMDFrame frame(64, 16);
+  uint32_t empty = frame.pixelHash();
+  frame.setPixel(24, 0);
+  frame.setPixel(24, 1);
+  CHECK(frame.pixelHash() != empty);
+  frame.clearScreen();
+  frame.setPixel(24, 3);
+  frame.setPixel(56, 9);
+  CHECK(frame.pixelHash() != empty);
+
+  // No two pixels on together hash the same as the empty frame
+  unsigned int collisions = 0;
+  frame.clearScreen();
+  for(unsigned int a = 0; a < 64 * 16; a++) {
+    frame.setPixel(a % 64, a / 64);
+    for(unsigned int b = a + 1; b < 64 * 16; b++) {
+      frame.setPixel(b % 64, b / 64);
+      if(frame.pixelHash() == empty)
+        collisions++;
+      frame.setPixel(b % 64, b / 64, GRAPHICS_OFF);
+    }
+    frame.setPixel(a % 64, a / 64, GRAPHICS_OFF);
+  }
+  CHECK_EQUAL(collisions, 0);
+}
+
+static void testCompareAndCount()
+{
+  DMDFrame a(40, 32);
+  randomPixels(a, 50);
+  DMDFrame b(a);
+  CHECK(a == b);
+  unsigned int on = 0;
+  for(unsigned int y = 0; y < a.height; y++)
+    for(unsigned int x = 0; x < a.width; x++)
+      on += a.getPixel(x, y);
+  CHECK_EQUAL(a.countPixelsOn(), on);
+
+  b.setPixel(39, 31, GRAPHICS_XOR);
+  CHECK(a != b);
+  b.setPixel(39, 31, GRAPHICS_XOR);
+  CHECK(a == b);
+
+  DMDFrame c(40, 16);
+  CHECK(a != c);
+}
+
+int main()
+{
+  randomSeed(45);
+  testHash();
+  testHashCollisions();
+  testCompareAndCount();
+  return checkResult();
+}
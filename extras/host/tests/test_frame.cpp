@@ -0,0 +1,180 @@
+/*
+ Host tests for DMDFrame, text drawing, DMD_TextBox and BaseDMD scanning
+*/
+#include "DMD2.h"
+#include "host.h"
+#include "check.h"
+#include <fonts/SystemFont5x7.h>
+#include <fonts/Arial14.h>
+
+static bool sameImage(DMDFrame &a, DMDFrame &b)
+{
+  if(a.width != b.width || a.height != b.height)
+    return false;
+  for(unsigned int y = 0; y < a.height; y++)
+    for(unsigned int x = 0; x < a.width; x++)
+      if(a.getPixel(x, y) != b.getPixel(x, y))
+        return false;
+  return true;
+}
+
+static unsigned int pixelsOn(DMDFrame &frame)
+{
+  unsigned int count = 0;
+  for(unsigned int y = 0; y < frame.height; y++)
+    for(unsigned int x = 0; x < frame.width; x++)
+      count += frame.getPixel(x, y);
+  return count;
+}
+
+// Each pixel can be set on its own, without any other pixel changing (ie rows don't overlap)
+static void testLayout(unsigned int width, unsigned int height)
+{
+  DMDFrame frame(width, height);
+  unsigned int failures = 0;
+  for(unsigned int y = 0; y < height; y++) {
+    for(unsigned int x = 0; x < width; x++) {
+      frame.setPixel(x, y);
+      if(pixelsOn(frame) != 1 || !frame.getPixel(x, y))
+        failures++;
+      frame.setPixel(x, y, GRAPHICS_OFF);
+    }
+  }
+  CHECK_EQUAL(failures, 0);
+}
+
+static void testText()
+{
+  DMDFrame expected(64, 16), actual(64, 16);
+  expected.selectFont(SystemFont5x7);
+  actual.selectFont(SystemFont5x7);
+
+  // drawString is drawChar with a column of space between characters
+  int x = 0;
+  for(const char *c = "Hello"; *c; c++)
+    x += expected.drawChar(x, 2, *c) + 1;
+  actual.drawString(0, 2, "Hello");
+  CHECK(sameImage(expected, actual));
+  CHECK_EQUAL(actual.stringWidth("Hello"), x - 1);
+
+  // A text box draws the same characters, then wraps onto the next line
+  expected.selectFont(Arial14);
+  actual.selectFont(Arial14);
+  expected.clearScreen();
+  actual.clearScreen();
+  expected.drawString(0, 0, "Hi 42");
+  DMD_TextBox box(actual);
+  box.print("Hi ");
+  box.print(42);
+  CHECK(sameImage(expected, actual));
+}
+
+static bool sameRuns(DMD_TextLayout &a, DMD_TextLayout &b)
+{
+  if(a.getLineCount() != b.getLineCount())
+    return false;
+  for(uint8_t i = 0; i < a.getLineCount(); i++) {
+    const DMDTextRun &ra = a.getLine(i), &rb = b.getLine(i);
+    if(ra.start != rb.start || ra.end != rb.end || ra.x != rb.x || ra.y != rb.y)
+      return false;
+  }
+  return true;
+}
+
+// Laying out the same text again reuses the runs, text that's changed (even in place) doesn't
+static void testLayoutCache()
+{
+  DMDFrame frame(64, 32);
+  frame.selectFont(SystemFont5x7);
+  DMD_TextLayout layout(frame, 0, 0, 48, 32);
+  char text[32];
+  strcpy(text, "one two three");
+  CHECK_EQUAL(layout.layout(text), 2);
+  unsigned long allocations = host_getHeapAllocations();
+  char same[32];
+  strcpy(same, text);
+  CHECK_EQUAL(layout.layout(same), 2);
+  CHECK_EQUAL(host_getHeapAllocations(), allocations); // shorter or the same, copy is reused
+
+  strcpy(text, "fourfive");
+  CHECK_EQUAL(layout.layout(text), 1);
+  DMD_TextLayout fresh(frame, 0, 0, 48, 32);
+  fresh.layout(text);
+  CHECK(sameRuns(layout, fresh));
+
+  strcpy(text, "a b c d e f g h i j k");
+  layout.setAlignment(ALIGN_RIGHT);
+  fresh.setAlignment(ALIGN_RIGHT);
+  layout.layout(text);
+  fresh.layout(text);
+  CHECK(sameRuns(layout, fresh));
+  CHECK_EQUAL(layout.layout(NULL), 0);
+  CHECK(layout.layout(text) > 0);
+}
+
+static void testScan()
+{
+  SPIDMD dmd(2, 1);
+  dmd.beginNoTimer();
+  unsigned long bytes = host_getSPIBytes();
+  dmd.scanDisplay();
+  // Four interleaved rows of both panels
+  CHECK_EQUAL(host_getSPIBytes() - bytes, 4 * 2 * PANEL_WIDTH / 8);
+}
+
+static void testHeap()
+{
+  size_t in_use = host_getHeapInUse();
+  unsigned long allocations = host_getHeapAllocations();
+  {
+    DMDFrame frame(64, 32);
+    DMDFrame copy(frame);
+    CHECK_EQUAL(host_getHeapAllocations() - allocations, 2);
+    CHECK(host_getHeapInUse() >= in_use + 2 * 64 * 32 / 8);
+  }
+  CHECK_EQUAL(host_getHeapInUse(), in_use);
+}
+
+// Selecting the font that's already selected doesn't rebuild its glyph offset table
+static void testSelectFontAgain()
+{
+  DMDFrame frame(64, 16);
+  frame.selectFont(Arial14);
+  unsigned long allocations = host_getHeapAllocations();
+  frame.selectFont(Arial14);
+  CHECK_EQUAL(host_getHeapAllocations(), allocations);
+  frame.drawString(0, 0, "Hi");
+  CHECK(pixelsOn(frame) > 0);
+
+  // A different font does, and then the first one again
+  frame.selectFont(SystemFont5x7);
+  frame.selectFont(Arial14);
+  CHECK_EQUAL(host_getHeapAllocations(), allocations + 1);
+}
+
+// Boxes ending just off the left edge (x2 of -1 wraps round to the biggest unsigned int) draw nothing
+static void testFilledBoxOffLeft()
+{
+  DMDFrame frame(32, 16);
+  frame.selectFont(SystemFont5x7);
+  frame.drawFilledBox(-3, 2, -1, 8, GRAPHICS_XOR);
+  frame.drawFilledBox(-3, 2, -1, 8, GRAPHICS_ON);
+  CHECK_EQUAL(frame.drawChar(-1 - frame.charWidth(' '), 2, ' ', GRAPHICS_XOR), frame.charWidth(' '));
+  CHECK_EQUAL(pixelsOn(frame), 0);
+}
+
+int main()
+{
+  testLayout(32, 16);
+  testLayout(64, 16);
+  testLayout(64, 48);
+  testLayout(40, 32); // not a whole number of panels wide
+  testLayout(20, 10);
+  testText();
+  testLayoutCache();
+  testScan();
+  testHeap();
+  testSelectFontAgain();
+  testFilledBoxOffLeft();
+  return checkResult();
+}
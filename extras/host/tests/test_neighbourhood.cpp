@@ -0,0 +1,155 @@
+/*
+ Host tests for the neighbourhood operations (Life, dilate, erode, outline), against a pixel at
+ a time reference
+*/
+#include "DMD2.h"
+#include "host.h"
+#include "check.h"
+
+enum Op { LIFE, DILATE, ERODE, OUTLINE };
+
+static void randomImage(DMDFrame &frame, int percent_on)
+{
+  for(unsigned int y = 0; y < frame.height; y++)
+    for(unsigned int x = 0; x < frame.width; x++)
+      frame.setPixel(x, y, random(100) < percent_on ? GRAPHICS_ON : GRAPHICS_OFF);
+}
+
+static unsigned int differences(DMDFrame &a, DMDFrame &b)
+{
+  unsigned int count = 0;
+  for(unsigned int y = 0; y < a.height; y++)
+    for(unsigned int x = 0; x < a.width; x++)
+      count += a.getPixel(x, y) != b.getPixel(x, y);
+  return count;
+}
+
+// Pixels outside the frame are off
+static bool pixelAt(DMDFrame &frame, int x, int y)
+{
+  if(x < 0 || y < 0 || x >= (int)frame.width || y >= (int)frame.height)
+    return false;
+  return frame.getPixel(x, y);
+}
+
+// Work out one step a pixel at a time, from a copy of the frame
+static void stepReference(DMDFrame &frame, Op op, uint16_t birth, uint16_t survive)
+{
+  DMDFrame before(frame);
+  for(int y = 0; y < (int)frame.height; y++) {
+    for(int x = 0; x < (int)frame.width; x++) {
+      int neighbours = 0;
+      for(int dy = -1; dy <= 1; dy++)
+        for(int dx = -1; dx <= 1; dx++)
+          if(dx || dy)
+            neighbours += pixelAt(before, x + dx, y + dy);
+      bool on = before.getPixel(x, y);
+      switch(op) {
+      case LIFE:
+        on = ((on ? survive : birth) >> neighbours) & 1;
+        break;
+      case DILATE:
+        on = on || neighbours > 0;
+        break;
+      case ERODE:
+        on = on && neighbours == 8;
+        break;
+      case OUTLINE:
+        on = on && neighbours < 8;
+        break;
+      }
+      frame.setPixel(x, y, on ? GRAPHICS_ON : GRAPHICS_OFF);
+    }
+  }
+}
+
+static bool step(DMDFrame &frame, Op op, uint16_t birth, uint16_t survive)
+{
+  switch(op) {
+  case LIFE:
+    return frame.stepLife(birth, survive);
+  case DILATE:
+    frame.dilate();
+    break;
+  case ERODE:
+    frame.erode();
+    break;
+  case OUTLINE:
+    frame.outline();
+    break;
+  }
+  return true;
+}
+
+/* Each operation gives the same pixels as the reference, over a few steps from random images
+   of different densities. Ring rows frames are scrolled first, so their rows aren't in order. */
+static void testOps(byte width, byte height, bool ring_rows)
+{
+  static const Op OPS[] = { LIFE, DILATE, ERODE, OUTLINE };
+  unsigned int failures = 0;
+  for(unsigned int o = 0; o < sizeof(OPS) / sizeof(OPS[0]); o++) {
+    for(int density = 10; density <= 90; density += 40) {
+      DMDFrame actual(width, height);
+      randomImage(actual, density);
+      if(ring_rows) {
+        actual.setRingRows(true);
+        actual.scrollY(random(1, height + 1));
+        randomImage(actual, density);
+      }
+      DMDFrame expected(width, height);
+      expected.copyFrame(actual, 0, 0);
+      for(int n = 0; n < 4; n++) {
+        uint16_t birth = DMD_LIFE_BIRTH, survive = DMD_LIFE_SURVIVE;
+        if(n == 3) { // some other rule
+          birth = random(0x200) & ~1;
+          survive = random(0x200);
+        }
+        DMDFrame before(expected);
+        stepReference(expected, OPS[o], birth, survive);
+        bool changed = step(actual, OPS[o], birth, survive);
+        if(OPS[o] == LIFE && changed != (differences(before, expected) != 0))
+          failures++;
+        if(differences(actual, expected)) {
+          failures++;
+          expected.copyFrame(actual, 0, 0); // carry on from the same image
+        }
+      }
+    }
+  }
+  CHECK_EQUAL(failures, 0);
+}
+
+// Known patterns: a blinker flips between horizontal and vertical, a block stays the same
+static void testPatterns()
+{
+  DMDFrame frame(32, 16);
+  frame.drawLine(9, 5, 11, 5);
+  CHECK(frame.stepLife());
+  CHECK(!frame.getPixel(9, 5) && frame.getPixel(10, 4) && frame.getPixel(10, 5) && frame.getPixel(10, 6));
+  CHECK(frame.stepLife());
+  CHECK(frame.getPixel(9, 5) && !frame.getPixel(10, 4));
+
+  frame.clearScreen();
+  frame.drawFilledBox(0, 0, 1, 1);
+  CHECK(!frame.stepLife());
+  CHECK(frame.getPixel(0, 0) && frame.getPixel(1, 1));
+}
+
+int main()
+{
+  randomSeed(44);
+  testOps(32, 16, false);
+  testOps(64, 16, false);
+  testOps(96, 16, false);
+  testOps(128, 16, false);
+  testOps(192, 16, false);
+  testOps(255, 16, false);
+  testOps(1, 1, false);
+  testOps(13, 7, false);
+  testOps(33, 17, false);
+  testOps(255, 5, false);
+  testOps(32, 16, true);
+  testOps(41, 23, true);
+  testPatterns();
+  return checkResult();
+}
@@ -0,0 +1,88 @@
+/*
+ Host test for DMDScanStats, with DMD_STATS_CLOCK replaced by a scripted clock
+
+ The statistics are only compiled in with DMD_SCAN_STATS, which changes BaseDMD, so this
+ test builds the library sources it needs itself rather than linking the library.
+*/
+#include <stdint.h>
+
+// Each call to the clock returns the next timestamp from the script
+static const uint32_t *clock_script;
+static uint32_t clockTicks() { return clock_script ? *clock_script++ : 0; }
+
+#define DMD_SCAN_STATS
+#define DMD_STATS_CLOCK() clockTicks()
+
+#include "DMD2.cpp"
+#include "DMD2_Timer.cpp"
+#include "DMDFrame.cpp"
+
+#include "host.h"
+#include "check.h"
+
+const uint8_t OTHER_CS = 5;
+
+int main()
+{
+  SPIDMD dmd(1, 1);
+  dmd.setOtherCS(OTHER_CS);
+  dmd.beginNoTimer();
+  dmd.resetScanStats();
+
+  // Start and end of each scan, or only the start of a skipped scan
+  static const uint32_t script[] = {
+    1000, 1100,  // 100 long
+    3000, 3300,  // 300 long, 2000 since the last start (bin 1)
+    5000,        // skipped, 2000 since the last start (bin 1)
+    6000, 6200,  // 200 long, 1000 since the last start (bin 0)
+    20000, 20050 // 50 long, 14000 since the last start (last bin)
+  };
+  clock_script = script;
+  dmd.scanDisplay();
+  dmd.scanDisplay();
+  host_setInput(OTHER_CS, LOW); // something else is using the SPI bus
+  dmd.scanDisplay();
+  host_setInput(OTHER_CS, HIGH);
+  dmd.scanDisplay();
+  dmd.scanDisplay();
+  CHECK(clock_script == script + sizeof(script) / sizeof(script[0]));
+
+  DMDScanStats stats;
+  dmd.getScanStats(stats);
+  CHECK_EQUAL(stats.scans, 4);
+  CHECK_EQUAL(stats.skipped, 1);
+  CHECK_EQUAL(stats.min_time, 50);
+  CHECK_EQUAL(stats.max_time, 300);
+  CHECK_EQUAL(stats.total_time, 650);
+  CHECK_EQUAL(stats.avg_time(), 650 / 4);
+  CHECK(stats.cpu_fraction() == (float)650 / (20050 - 1000));
+  static const uint32_t intervals[DMD_STATS_HISTOGRAM_BINS] = { 1, 2, 0, 0, 0, 0, 0, 1 };
+  for(int i = 0; i < DMD_STATS_HISTOGRAM_BINS; i++)
+    CHECK_EQUAL(stats.intervals[i], intervals[i]);
+
+  // Times still come out right when the clock wraps round
+  static const uint32_t wrap_script[] = {
+    0xFFFFFF00UL, 0xFFFFFF80UL,
+    0xFFFFFFF0UL, 0x00000040UL,
+  };
+  dmd.resetScanStats();
+  clock_script = wrap_script;
+  dmd.scanDisplay();
+  dmd.scanDisplay();
+  dmd.getScanStats(stats);
+  CHECK_EQUAL(stats.scans, 2);
+  CHECK_EQUAL(stats.skipped, 0);
+  CHECK_EQUAL(stats.min_time, 0x50);
+  CHECK_EQUAL(stats.max_time, 0x80);
+  CHECK_EQUAL(stats.intervals[0], 1);
+  CHECK(stats.cpu_fraction() == (float)0xD0 / 0x140);
+
+  // Reset clears everything
+  dmd.resetScanStats();
+  dmd.getScanStats(stats);
+  CHECK_EQUAL(stats.scans, 0);
+  CHECK_EQUAL(stats.avg_time(), 0);
+  CHECK(stats.cpu_fraction() == 0);
+
+  return checkResult();
+}
@@ -0,0 +1,290 @@
+/*
+ Host tests for DMD_StreamReceiver, fed through a pseudo terminal as a serial port would be
+
+ Packets are encoded by extras/dmdstream.py (through stream_encode.py, needs python3) as
+ well as by the test itself.
+*/
+#include "DMD2.h"
+#include "host.h"
+#include "check.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include <termios.h>
+#include <vector>
+
+typedef std::vector<uint8_t> Bytes;
+
+/* Both ends of a pty in raw mode. Bytes sent in at the far end are read by the receiver
+   from this Stream, after passing through the kernel's tty layer like serial data. */
+class PtyLoopback : public Stream {
+public:
+  PtyLoopback() : master(-1), far_end(-1), peeked(-1) {
+    master = posix_openpt(O_RDWR | O_NOCTTY);
+    if(master < 0 || grantpt(master) || unlockpt(master))
+      return;
+    far_end = open(ptsname(master), O_RDWR | O_NOCTTY);
+    struct termios raw;
+    if(far_end < 0 || tcgetattr(far_end, &raw))
+      return;
+    cfmakeraw(&raw);
+    tcsetattr(far_end, TCSANOW, &raw);
+    fcntl(master, F_SETFL, O_NONBLOCK);
+    fcntl(far_end, F_SETFL, O_NONBLOCK);
+  }
+  ~PtyLoopback() {
+    close(far_end);
+    close(master);
+  }
+  bool ok() { return far_end >= 0; }
+
+  // Send as much as the pty will take, returns how much that was
+  size_t send(const uint8_t *data, size_t size) {
+    ssize_t res = ::write(far_end, data, size);
+    return res > 0 ? res : 0;
+  }
+
+  int available() {
+    if(peeked < 0) {
+      uint8_t c;
+      if(::read(master, &c, 1) == 1)
+        peeked = c;
+    }
+    return peeked >= 0 ? 1 : 0;
+  }
+  int read() {
+    int c = available() ? peeked : -1;
+    peeked = -1;
+    return c;
+  }
+  int peek() { return available() ? peeked : -1; }
+  size_t write(uint8_t) { return 0; }
+
+private:
+  int master;
+  int far_end;
+  int peeked;
+};
+
+static void appendPacket(Bytes &stream, uint8_t type, const Bytes &payload)
+{
+  Bytes body;
+  body.push_back(type);
+  body.push_back(payload.size() & 0xFF);
+  body.push_back(payload.size() >> 8);
+  body.insert(body.end(), payload.begin(), payload.end());
+  uint16_t crc = 0xFFFF;
+  for(size_t i = 0; i < body.size(); i++)
+    crc = DMD_StreamReceiver::crcUpdate(crc, body[i]);
+  stream.push_back(DMD_STREAM_SYNC1);
+  stream.push_back(DMD_STREAM_SYNC2);
+  stream.insert(stream.end(), body.begin(), body.end());
+  stream.push_back(crc & 0xFF);
+  stream.push_back(crc >> 8);
+}
+
+// Random linear frame, with the bits past the right edge clear as exportLinear() leaves them
+static Bytes randomFrame(unsigned int width, unsigned int height, const Bytes *previous = NULL)
+{
+  unsigned int row_bytes = (width + 7) / 8;
+  Bytes frame(row_bytes * height);
+  if(previous && random(4)) {
+    // a few changes, sometimes a cleared row
+    frame = *previous;
+    for(int i = random(20); i > 0; i--)
+      frame[random(frame.size())] = random(256);
+    if(random(3) == 0)
+      memset(&frame[random(height) * row_bytes], 0, row_bytes);
+  }
+  else {
+    for(size_t i = 0; i < frame.size(); i++)
+      frame[i] = random(256);
+  }
+  if(width & 7) {
+    for(unsigned int y = 0; y < height; y++)
+      frame[y * row_bytes + row_bytes - 1] &= 0xFF << (8 - (width & 7));
+  }
+  return frame;
+}
+
+static Bytes shownFrame(DMDFrame &frame)
+{
+  Bytes pixels(((frame.width + 7) / 8) * frame.height);
+  frame.exportLinear(&pixels[0]);
+  return pixels;
+}
+
+// Send all of 'bytes' through the pty and wait for them to come out the other end
+static void sendAll(PtyLoopback &pty, const Bytes &bytes)
+{
+  size_t sent = 0;
+  while(sent < bytes.size()) {
+    sent += pty.send(&bytes[sent], bytes.size() - sent);
+    usleep(100);
+  }
+  usleep(2000);
+}
+
+/* Send bytes through the pty, polling the receiver (and scanning the display) as they go,
+   until they've all been read */
+static void feed(PtyLoopback &pty, DMD_StreamReceiver &receiver, VirtualDMD *dmd, const Bytes &bytes)
+{
+  size_t sent = 0;
+  int idle = 0;
+  while(idle < 20) {
+    if(sent < bytes.size())
+      sent += pty.send(&bytes[sent], bytes.size() - sent);
+    receiver.poll(pty);
+    if(dmd) {
+      for(int i = 0; i < 4; i++)
+        dmd->scanDisplay();
+    }
+    if(sent < bytes.size() || pty.available()) {
+      idle = 0;
+    }
+    else {
+      idle++;
+      usleep(50);
+    }
+  }
+}
+
+/* Frames encoded by dmdstream.py as full, delta rows and RLE delta packets, sent a packet at a
+   time. Each one must show exactly the frame that was sent. */
+static void testPacketTypes(unsigned int width, unsigned int height, bool present)
+{
+  const int FRAMES = 40;
+  std::vector<Bytes> frames;
+  FILE *f = fopen("stream_frames.tmp", "wb");
+  for(int i = 0; i < FRAMES; i++) {
+    frames.push_back(randomFrame(width, height, i ? &frames.back() : NULL));
+    fwrite(&frames.back()[0], 1, frames.back().size(), f);
+  }
+  fclose(f);
+  char command[128];
+  snprintf(command, sizeof(command), "python3 stream_encode.py stream_frames.tmp %u %u stream_packets.tmp", width, height);
+  CHECK_EQUAL(system(command), 0);
+  Bytes stream;
+  f = fopen("stream_packets.tmp", "rb");
+  CHECK(f != NULL);
+  if(!f)
+    return;
+  for(int c = fgetc(f); c != EOF; c = fgetc(f))
+    stream.push_back(c);
+  fclose(f);
+  remove("stream_frames.tmp");
+  remove("stream_packets.tmp");
+
+  PtyLoopback pty;
+  CHECK(pty.ok());
+  VirtualDMD *dmd = present ? new VirtualDMD(width / PANEL_WIDTH, height / PANEL_HEIGHT) : NULL;
+  if(dmd)
+    dmd->beginNoTimer();
+  DMDFrame front(width, height), back(width, height);
+  DMD_StreamReceiver *receiver = dmd ? new DMD_StreamReceiver(*dmd, back) : new DMD_StreamReceiver(front, back);
+  DMDFrame &shown = dmd ? *(DMDFrame *)dmd : front;
+
+  // Each packet's length is at bytes 3-4
+  size_t pos = 0;
+  unsigned int mismatches = 0;
+  for(int i = 0; i < FRAMES && pos + 7 <= stream.size(); i++) {
+    size_t length = 7 + (stream[pos + 3] | (stream[pos + 4] << 8));
+    feed(pty, *receiver, dmd, Bytes(stream.begin() + pos, stream.begin() + pos + length));
+    pos += length;
+    CHECK_EQUAL(receiver->getFrameCount(), i + 1);
+    if(shownFrame(shown) != frames[i])
+      mismatches++;
+  }
+  CHECK_EQUAL(pos, stream.size());
+  CHECK_EQUAL(mismatches, 0);
+  CHECK_EQUAL(receiver->getErrorCount(), 0);
+  delete receiver;
+  delete dmd;
+}
+
+// A packet with a bad CRC is dropped, and the packet after it still gets through
+static void testBadCRC()
+{
+  PtyLoopback pty;
+  DMDFrame front(64, 16), back(64, 16);
+  DMD_StreamReceiver receiver(front, back);
+  Bytes first = randomFrame(64, 16), second = randomFrame(64, 16);
+  Bytes stream;
+  appendPacket(stream, DMD_STREAM_FULL, first);
+  stream[20] ^= 0x04;
+  appendPacket(stream, DMD_STREAM_FULL, second);
+  feed(pty, receiver, NULL, stream);
+  CHECK_EQUAL(receiver.getErrorCount(), 1);
+  CHECK_EQUAL(receiver.getFrameCount(), 1);
+  CHECK(shownFrame(front) == second);
+}
+
+/* Line noise that looks like the start of a packet: sync bytes followed by a length longer
+   than any packet could be, or a packet type that doesn't exist. The receiver finds the real
+   packet after it. */
+static void testFalseSync()
+{
+  PtyLoopback pty;
+  DMDFrame front(64, 16), back(64, 16);
+  DMD_StreamReceiver receiver(front, back);
+  Bytes frame = randomFrame(64, 16);
+  static const uint8_t noise[] = {
+    0x00, DMD_STREAM_SYNC1, DMD_STREAM_SYNC1, DMD_STREAM_SYNC2, DMD_STREAM_FULL, 0xFF, 0x7F, // too long
+    DMD_STREAM_SYNC1, DMD_STREAM_SYNC2, DMD_STREAM_FULL, 129, 0, // one byte more than a full frame
+    DMD_STREAM_SYNC1, 0x55,
+  };
+  Bytes stream(noise, noise + sizeof(noise));
+  appendPacket(stream, 'X', Bytes()); // unknown type
+  appendPacket(stream, DMD_STREAM_FULL, frame);
+  feed(pty, receiver, NULL, stream);
+  CHECK_EQUAL(receiver.getErrorCount(), 3);
+  CHECK_EQUAL(receiver.getFrameCount(), 1);
+  CHECK(shownFrame(front) == frame);
+}
+
+/* With a display, a finished frame waits for the start of the next scan. Until then the next
+   packet isn't decoded past its length and its bytes are left in the stream. */
+static void testBackPressure()
+{
+  PtyLoopback pty;
+  VirtualDMD dmd(2, 1);
+  dmd.beginNoTimer();
+  DMDFrame back(64, 16);
+  DMD_StreamReceiver receiver(dmd, back);
+  Bytes first = randomFrame(64, 16), second = randomFrame(64, 16);
+  Bytes stream;
+  appendPacket(stream, DMD_STREAM_FULL, first);
+  appendPacket(stream, DMD_STREAM_FULL, second);
+  sendAll(pty, stream);
+
+  CHECK(receiver.poll(pty));
+  CHECK_EQUAL(receiver.getFrameCount(), 1);
+  CHECK(dmd.presentPending());
+  CHECK(!receiver.poll(pty)); // stuck until the frame is shown
+  CHECK(pty.available());
+  CHECK_EQUAL(receiver.write((uint8_t)0), 0);
+
+  while(dmd.presentPending())
+    dmd.scanDisplay();
+  CHECK(shownFrame(dmd) == first);
+  CHECK(receiver.poll(pty));
+  CHECK_EQUAL(receiver.getFrameCount(), 2);
+  CHECK(!pty.available());
+  while(dmd.presentPending())
+    dmd.scanDisplay();
+  CHECK(shownFrame(dmd) == second);
+  CHECK_EQUAL(receiver.getErrorCount(), 0);
+}
+
+int main()
+{
+  randomSeed(47);
+  testPacketTypes(128, 16, false);
+  testPacketTypes(128, 16, true);
+  testPacketTypes(64, 32, true);
+  testPacketTypes(37, 11, false);
+  testPacketTypes(224, 64, false);
+  testBadCRC();
+  testFalseSync();
+  testBackPressure();
+  return checkResult();
+}
@@ -0,0 +1,222 @@
+/*
+ Host tests for drawing glyphs, against a pixel at a time reference drawn with setPixel()
+*/
+#include "DMD2.h"
+#include "host.h"
+#include "check.h"
+#include <fonts/SystemFont5x7.h>
+#include <fonts/Arial14.h>
+#include <fonts/Arial_Black_16.h>
+#include <fonts/Droid_Sans_24.h>
+
+static const DMDGraphicsMode MODES[] = {
+  GRAPHICS_OFF, GRAPHICS_ON, GRAPHICS_INVERSE, GRAPHICS_OR, GRAPHICS_NOR, GRAPHICS_XOR,
+};
+
+// Read a glyph's width and data straight from the font, without using the library
+static const uint8_t *glyphData(const uint8_t *font, char letter, uint8_t &width)
+{
+  FontHeader header;
+  memcpy_P(&header, font, sizeof(FontHeader));
+  uint8_t c = letter - header.firstChar;
+  uint8_t bytes = (header.height + 7) / 8;
+  if(header.size == 0) {
+    width = header.fixedWidth;
+    return font + sizeof(FontHeader) + c * bytes * width;
+  }
+  const uint8_t *data = font + sizeof(FontHeader) + header.charCount;
+  for(uint8_t i = 0; i < c; i++)
+    data += pgm_read_byte(font + sizeof(FontHeader) + i) * bytes;
+  width = pgm_read_byte(font + sizeof(FontHeader) + c);
+  return data;
+}
+
+/* Draw a glyph a pixel at a time, a byte of each column at a time. The last byte of a
+   multi-byte column is aligned to the bottom of the glyph, and only its rows below the
+   byte above are drawn. Single byte fonts also draw the (blank) row below the glyph. */
+static void drawReference(DMDFrame &frame, int x, int y, const uint8_t *font, char letter, DMDGraphicsMode mode)
+{
+  FontHeader header;
+  memcpy_P(&header, font, sizeof(FontHeader));
+  uint8_t width;
+  const uint8_t *data = glyphData(font, letter, width);
+  uint8_t bytes = (header.height + 7) / 8;
+  DMDGraphicsMode set_mode = (mode == GRAPHICS_INVERSE) ? GRAPHICS_OFF : mode;
+  DMDGraphicsMode clear_mode = inverseMode(mode);
+  if(set_mode == GRAPHICS_NOR)
+    set_mode = GRAPHICS_OFF; // (setPixel() treats NOR differently to drawing modes)
+
+  for(int i = 0; i < bytes; i++) {
+    int top = (bytes > 1 && i == bytes - 1) ? header.height - 8 : i * 8;
+    int rows = (bytes == 1) ? header.height + 1 : 8;
+    if(rows > 8)
+      rows = 8;
+    int first = i * 8 - top;
+    for(int col = 0; col < width; col++) {
+      uint8_t bits = pgm_read_byte(data + col + i * width);
+      for(int bit = first; bit < rows; bit++) {
+        int px = x + col, py = y + top + bit;
+        if(px >= 0 && py >= 0)
+          frame.setPixel(px, py, (bits & (1 << bit)) ? set_mode : clear_mode);
+      }
+    }
+  }
+}
+
+static void randomImage(DMDFrame &frame)
+{
+  for(unsigned int y = 0; y < frame.height; y++)
+    for(unsigned int x = 0; x < frame.width; x++)
+      frame.setPixel(x, y, random(2) ? GRAPHICS_ON : GRAPHICS_OFF);
+}
+
+static unsigned int differences(DMDFrame &a, DMDFrame &b)
+{
+  unsigned int count = 0;
+  for(unsigned int y = 0; y < a.height; y++)
+    for(unsigned int x = 0; x < a.width; x++)
+      count += a.getPixel(x, y) != b.getPixel(x, y);
+  return count;
+}
+
+// drawChar() in every mode, at random positions (including partly off each edge of the frame)
+static void testDrawChar(const uint8_t *font, unsigned int frame_width, unsigned int frame_height)
+{
+  DMDFrame expected(frame_width, frame_height);
+  randomImage(expected);
+  DMDFrame actual(expected);
+  actual.selectFont(font);
+  unsigned int failures = 0;
+  for(int n = 0; n < 300; n++) {
+    char letter = random('!', '~' + 1);
+    DMDGraphicsMode mode = MODES[random(sizeof(MODES) / sizeof(MODES[0]))];
+    int x = random(-24, frame_width + 2);
+    int y = random(-26, frame_height + 2);
+    drawReference(expected, x, y, font, letter, mode);
+    uint8_t width;
+    glyphData(font, letter, width);
+    int drawn = actual.drawChar(x, y, letter, mode);
+    if(x < (int)frame_width && y < (int)frame_height && drawn != width)
+      failures++;
+    if(differences(expected, actual)) {
+      failures++;
+      actual.copyFrame(expected, 0, 0); // carry on from the same image
+    }
+  }
+  CHECK_EQUAL(failures, 0);
+}
+
+/* A text strip whose region hangs off any edge of the frame draws the visible part of the
+   same image as an unclipped strip */
+static void testTextStripClipped(int left, int top, bool lazy)
+{
+  const int width = 40, height = 12;
+  DMDFrame unclipped(width, height), frame(32, 16);
+  unclipped.selectFont(Arial14);
+  frame.selectFont(Arial14);
+  DMD_TextStrip expected(unclipped, 0, 0, width, height);
+  DMD_TextStrip actual(frame, left, top, width, height);
+  const char *text = "Hello there, a longer message";
+  CHECK(expected.setText(text, lazy));
+  CHECK(actual.setText(text, lazy));
+  unsigned int failures = 0;
+  for(int step = 0; step < 250; step++) {
+    randomImage(frame);
+    DMDFrame before(frame);
+    expected.scroll(3);
+    actual.scroll(3);
+    for(int y = 0; y < (int)frame.height; y++) {
+      for(int x = 0; x < (int)frame.width; x++) {
+        bool inside = x >= left && x < left + width && y >= top && y < top + height;
+        bool pixel = inside ? unclipped.getPixel(x - left, y - top) : before.getPixel(x, y);
+        failures += frame.getPixel(x, y) != pixel;
+      }
+    }
+  }
+  CHECK_EQUAL(failures, 0);
+}
+
+/* Same for a ticker, which drops the columns off the left edge from its ring of columns.
+   (Text comes on at the right edge of the frame if the region goes past it, so these all
+   end inside the frame.) */
+static void testTickerClipped(int left, int top, int width)
+{
+  const int height = 12;
+  DMDFrame unclipped(width, height), frame(32, 16);
+  unclipped.selectFont(Arial14);
+  frame.selectFont(Arial14);
+  DMD_Ticker expected(unclipped, 0, 0, width, height);
+  DMD_Ticker actual(frame, left, top, width, height);
+  randomImage(frame);
+  DMDFrame before(frame);
+  expected.print("Hello there");
+  actual.print("Hello there");
+  unsigned int failures = 0;
+  for(int step = 0; step < 60; step++) {
+    expected.step(2);
+    actual.step(2);
+    for(int y = 0; y < (int)frame.height; y++) {
+      for(int x = 0; x < (int)frame.width; x++) {
+        bool inside = x >= left && x < left + width && y >= top && y < top + height;
+        bool pixel = inside ? unclipped.getPixel(x - left, y - top) : before.getPixel(x, y);
+        failures += frame.getPixel(x, y) != pixel;
+      }
+    }
+  }
+  CHECK_EQUAL(failures, 0);
+}
+
+// Same for a text layout, including the box cleared around the text
+static void testLayoutClipped(int left, int top, DMDGraphicsMode mode)
+{
+  const int width = 60, height = 30;
+  DMDFrame unclipped(width, height), frame(32, 16);
+  randomImage(unclipped);
+  randomImage(frame);
+  for(int y = 0; y < (int)frame.height; y++) // same background where the box is visible
+    for(int x = 0; x < (int)frame.width; x++)
+      if(x >= left && x < left + width && y >= top && y < top + height)
+        frame.setPixel(x, y, unclipped.getPixel(x - left, y - top) ? GRAPHICS_ON : GRAPHICS_OFF);
+  DMDFrame before(frame);
+  DMD_TextLayout expected(unclipped, 0, 0, width, height);
+  DMD_TextLayout actual(frame, left, top, width, height);
+  expected.setAlignment(ALIGN_CENTER);
+  actual.setAlignment(ALIGN_CENTER);
+  expected.drawText("Hello there, a longer message", mode, SystemFont5x7);
+  actual.drawText("Hello there, a longer message", mode, SystemFont5x7);
+  unsigned int failures = 0;
+  for(int y = 0; y < (int)frame.height; y++) {
+    for(int x = 0; x < (int)frame.width; x++) {
+      bool inside = x >= left && x < left + width && y >= top && y < top + height;
+      bool pixel = inside ? unclipped.getPixel(x - left, y - top) : before.getPixel(x, y);
+      failures += frame.getPixel(x, y) != pixel;
+    }
+  }
+  CHECK_EQUAL(failures, 0);
+}
+
+int main()
+{
+  randomSeed(32);
+  testDrawChar(SystemFont5x7, 64, 16);
+  testDrawChar(Arial14, 64, 16);
+  testDrawChar(Arial_Black_16, 40, 20);
+  testDrawChar(Droid_Sans_24, 96, 32);
+  testDrawChar(Droid_Sans_24, 13, 7);
+  testTextStripClipped(-8, -4, false);
+  testTextStripClipped(-8, -4, true);
+  testTextStripClipped(-3, 9, false); // off the left and bottom
+  testTextStripClipped(13, -7, true); // off the top and right
+  testTextStripClipped(-50, 0, false); // entirely off the left
+  testTickerClipped(-8, 0, 40);
+  testTickerClipped(-8, -4, 40);
+  testTickerClipped(-3, 9, 35); // off the left and bottom
+  testTickerClipped(-20, -7, 30);
+  testTickerClipped(-50, 0, 40); // entirely off the left
+  testLayoutClipped(-5, -3, GRAPHICS_ON);
+  testLayoutClipped(-5, -3, GRAPHICS_INVERSE);
+  testLayoutClipped(-20, 4, GRAPHICS_XOR); // (box isn't cleared)
+  testLayoutClipped(10, -12, GRAPHICS_ON);
+  testLayoutClipped(-70, 0, GRAPHICS_ON); // entirely off the left
+  return checkResult();
+}
@@ -0,0 +1,115 @@
+/*
+ Host tests for DMD_TextBox scrolling, against a box that only ever printed the last lines
+*/
+#include "DMD2.h"
+#include "host.h"
+#include "check.h"
+#include <fonts/SystemFont5x7.h>
+#include <fonts/Arial14.h>
+
+static unsigned int differences(DMDFrame &a, DMDFrame &b)
+{
+  unsigned int count = 0;
+  for(unsigned int y = 0; y < a.height; y++)
+    for(unsigned int x = 0; x < a.width; x++)
+      count += a.getPixel(x, y) != b.getPixel(x, y);
+  return count;
+}
+
+static void randomImage(DMDFrame &frame)
+{
+  for(unsigned int y = 0; y < frame.height; y++)
+    for(unsigned int x = 0; x < frame.width; x++)
+      frame.setPixel(x, y, random(2) ? GRAPHICS_ON : GRAPHICS_OFF);
+}
+
+/* Writing runs of random text in one go, or in random sized pieces, draws exactly the same
+   as writing it a character at a time. Boxes too short for two lines scroll sideways. */
+static void testBulkWrite(const uint8_t *font)
+{
+  static const char CHARS[] = "abcdefgHIJKLM 0123456789.,!\n\n  ";
+  unsigned int failures = 0;
+  for(int n = 0; n < 150; n++) {
+    DMDFrame bulk(48, 40);
+    bulk.selectFont(font);
+    randomImage(bulk);
+    DMDFrame single(bulk);
+    int left = random(0, 10), top = random(0, 10);
+    int width = random(8, bulk.width - left + 1), height = random(6, bulk.height - top + 1);
+    DMD_TextBox bulk_box(bulk, left, top, width, height);
+    DMD_TextBox single_box(single, left, top, width, height);
+    if(random(2)) {
+      bulk_box.invertDisplay();
+      single_box.invertDisplay();
+    }
+
+    for(int run = 0; run < 4; run++) {
+      uint8_t text[60];
+      size_t length = random(1, sizeof(text) + 1);
+      for(size_t i = 0; i < length; i++)
+        text[i] = CHARS[random(sizeof(CHARS) - 1)];
+      for(size_t i = 0; i < length; ) {
+        size_t piece = random(2) ? length - i : random(1, length - i + 1);
+        bulk_box.write(text + i, piece);
+        i += piece;
+      }
+      for(size_t i = 0; i < length; i++)
+        single_box.write(text[i]);
+      if(differences(bulk, single)) {
+        failures++;
+        break;
+      }
+    }
+  }
+  CHECK_EQUAL(failures, 0);
+}
+
+/* Print many lines into a box with room for `lines` of them, so it scrolls up a line at a
+   time. It ends up showing the same as a box that only printed the last lines, and
+   scrolling doesn't allocate. */
+static void testConsoleScroll(int left, int top, int lines, bool inverted)
+{
+  const int row_height = 8; // SystemFont5x7 is 7 high, plus a row between lines
+  DMDFrame actual(40, 30), expected(40, 30);
+  actual.selectFont(SystemFont5x7);
+  expected.selectFont(SystemFont5x7);
+  actual.drawFilledBox(0, 0, actual.width - 1, actual.height - 1); // outside the box stays on
+  expected.drawFilledBox(0, 0, expected.width - 1, expected.height - 1);
+  DMD_TextBox console(actual, left, top, 30, lines * row_height);
+  DMD_TextBox last_lines(expected, left, top, 30, lines * row_height);
+  if(inverted) {
+    console.invertDisplay();
+    last_lines.invertDisplay();
+  }
+  console.clear();
+  last_lines.clear();
+
+  const int count = 20;
+  unsigned long allocations = host_getHeapAllocations();
+  for(int i = 0; i < count; i++) {
+    if(i)
+      console.print('\n');
+    console.print("Ln ");
+    console.print(i);
+  }
+  CHECK_EQUAL(host_getHeapAllocations(), allocations);
+
+  for(int i = count - lines; i < count; i++) {
+    if(i > count - lines)
+      last_lines.print('\n');
+    last_lines.print("Ln ");
+    last_lines.print(i);
+  }
+  CHECK_EQUAL(differences(actual, expected), 0);
+}
+
+int main()
+{
+  randomSeed(39);
+  testBulkWrite(SystemFont5x7);
+  testBulkWrite(Arial14);
+  testConsoleScroll(0, 0, 2, false);
+  testConsoleScroll(3, 2, 3, false);
+  testConsoleScroll(5, 1, 2, true);
+  return checkResult();
+}
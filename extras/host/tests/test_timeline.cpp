@@ -0,0 +1,298 @@
+/*
+ Host tests for DMD_Timeline, driven by a fake clock passed to tick()
+*/
+#include "DMD2.h"
+#include "host.h"
+#include "check.h"
+#include <vector>
+
+typedef std::vector<std::vector<bool> > Pixels;
+
+static Pixels grab(DMDFrame &frame)
+{
+  Pixels pixels(frame.width, std::vector<bool>(frame.height));
+  for(unsigned int x = 0; x < frame.width; x++)
+    for(unsigned int y = 0; y < frame.height; y++)
+      pixels[x][y] = frame.getPixel(x, y);
+  return pixels;
+}
+
+static void randomPixels(DMDFrame &frame)
+{
+  for(unsigned int x = 0; x < frame.width; x++)
+    for(unsigned int y = 0; y < frame.height; y++)
+      frame.setPixel(x, y, random(2) ? GRAPHICS_ON : GRAPHICS_OFF);
+}
+
+// Scroll a region one pixel step at a time, as the timeline should
+static void referenceScroll(Pixels &pixels, int left, int top, int width, int height,
+                            int dx, int dy, bool wrap, unsigned long steps)
+{
+  for(unsigned long s = 0; s < steps; s++) {
+    Pixels old = pixels;
+    for(int x = 0; x < width; x++) {
+      for(int y = 0; y < height; y++) {
+        int from_x = x - dx, from_y = y - dy;
+        bool on;
+        if(wrap)
+          on = old[left + ((from_x % width) + width) % width][top + ((from_y % height) + height) % height];
+        else
+          on = from_x >= 0 && from_x < width && from_y >= 0 && from_y < height && old[left + from_x][top + from_y];
+        pixels[left + x][top + y] = on;
+      }
+    }
+  }
+}
+
+// Track function that counts its calls and steps
+struct Counter {
+  unsigned long calls;
+  unsigned long steps;
+  unsigned int last_steps;
+};
+
+static void countSteps(DMDFrame &frame, void *context, unsigned int steps)
+{
+  (void)frame;
+  Counter *counter = (Counter *)context;
+  counter->calls++;
+  counter->steps += steps;
+  counter->last_steps = steps;
+}
+
+/* Ticks at random times, some a few periods apart. The steps always add up to the time
+   elapsed (no drift, however late the ticks are), several steps are batched into one call
+   when a tick is more than a period late, and lateness is how long after the first due step
+   the tick came. Half the runs start just before the clock wraps round (as millis() does
+   on a board, where unsigned long is 32 bits.) */
+static void testCatchUp()
+{
+  for(int run = 0; run < 200; run++) {
+    DMDFrame frame(32, 16);
+    DMD_Timeline timeline(frame);
+    Counter counter = { 0, 0, 0 };
+    unsigned long period = 1 + random(100);
+    unsigned long start = (run & 1) ? ~0UL - 0xFF - random(1000) : random(1000);
+    int track = timeline.addFunction(period, countSteps, &counter);
+    CHECK_EQUAL(track, 0);
+
+    CHECK(timeline.tick(start));
+    CHECK_EQUAL(counter.calls, 1); // first tick draws the track without stepping it
+    CHECK_EQUAL(counter.steps, 0);
+
+    unsigned long now = start;
+    uint16_t max_lateness = 0;
+    bool batched = false;
+    for(int i = 0; i < 300; i++) {
+      unsigned long calls = counter.calls;
+      now += random(3 * period + 1);
+      bool drawn = timeline.tick(now);
+      CHECK_EQUAL(counter.steps, (now - start) / period);
+      CHECK_EQUAL(drawn, counter.calls != calls);
+      if(counter.calls != calls) {
+        unsigned long lateness = (now - start) % period + (counter.last_steps - 1) * period;
+        CHECK_EQUAL(timeline.getLateness(track), lateness);
+        if(timeline.getLateness(track) > max_lateness)
+          max_lateness = timeline.getLateness(track);
+        if(counter.last_steps > 1)
+          batched = true;
+      }
+    }
+    CHECK_EQUAL(timeline.getMaxLateness(track), max_lateness);
+    CHECK_EQUAL(timeline.getSkippedSteps(track), 0);
+    if(period > 1)
+      CHECK(batched);
+  }
+}
+
+// A long stall is capped at DMD_TIMELINE_MAX_STEPS steps, the rest are counted as skipped
+static void testMaxSteps()
+{
+  DMDFrame frame(32, 16);
+  DMD_Timeline timeline(frame);
+  Counter counter = { 0, 0, 0 };
+  int track = timeline.addFunction(10, countSteps, &counter);
+  timeline.tick(5);
+  timeline.tick(5 + 10 * 100 + 3);
+  CHECK_EQUAL(counter.last_steps, DMD_TIMELINE_MAX_STEPS);
+  CHECK_EQUAL(timeline.getSkippedSteps(track), 100 - DMD_TIMELINE_MAX_STEPS);
+  CHECK_EQUAL(timeline.getLateness(track), 10 * 99 + 3);
+  CHECK_EQUAL(timeline.getMaxLateness(track), 10 * 99 + 3);
+
+  // ...and it stays in phase afterwards
+  counter.calls = 0;
+  CHECK(!timeline.tick(5 + 10 * 101 - 1));
+  CHECK_EQUAL(counter.calls, 0);
+  CHECK(timeline.tick(5 + 10 * 101));
+  CHECK_EQUAL(counter.last_steps, 1);
+  CHECK_EQUAL(timeline.getLateness(track), 0);
+  CHECK_EQUAL(timeline.getMaxLateness(track), 10 * 99 + 3);
+
+  // Skipped steps add up
+  timeline.tick(5 + 10 * 101 + 10 * 70);
+  CHECK_EQUAL(timeline.getSkippedSteps(track), 100 - DMD_TIMELINE_MAX_STEPS + 70 - DMD_TIMELINE_MAX_STEPS);
+}
+
+// A period of 0 pauses a track, setting one again starts it afresh from the next tick
+static void testPause()
+{
+  DMDFrame frame(32, 16);
+  DMD_Timeline timeline(frame);
+  Counter counter = { 0, 0, 0 };
+  int track = timeline.addFunction(10, countSteps, &counter);
+  timeline.tick(0);
+  timeline.setPeriod(track, 0);
+  counter.calls = 0;
+  CHECK(!timeline.tick(100000));
+  CHECK_EQUAL(counter.calls, 0);
+
+  timeline.setPeriod(track, 7);
+  CHECK(timeline.tick(200000));
+  CHECK_EQUAL(counter.calls, 1);
+  CHECK_EQUAL(counter.last_steps, 0); // no steps for the time it was paused
+  CHECK(!timeline.tick(200006));
+  CHECK(timeline.tick(200007));
+  CHECK_EQUAL(counter.last_steps, 1);
+
+  // Changing the period of a running track keeps the step that's already due
+  timeline.setPeriod(track, 100);
+  CHECK(!timeline.tick(200013));
+  CHECK(timeline.tick(200014));
+  CHECK(!timeline.tick(200113));
+  CHECK(timeline.tick(200114));
+
+  timeline.remove(track);
+  counter.calls = 0;
+  CHECK(!timeline.tick(300000));
+  CHECK_EQUAL(counter.calls, 0);
+  CHECK_EQUAL(timeline.getLateness(track), 0);
+
+  for(int i = 0; i < DMD_TIMELINE_TRACKS; i++)
+    CHECK_EQUAL(timeline.addFunction(1, countSteps, &counter), i);
+  CHECK_EQUAL(timeline.addFunction(1, countSteps, &counter), -1);
+}
+
+// Scrolling regions of all sizes match scrolling a pixel at a time
+static void testScroll()
+{
+  unsigned int mismatches = 0;
+  for(int run = 0; run < 2000; run++) {
+    int panels_wide = 1 + random(3), panels_high = 1 + random(2);
+    DMDFrame frame(panels_wide * PANEL_WIDTH - (random(2) ? random(8) : 0), panels_high * PANEL_HEIGHT);
+    if(random(3) == 0)
+      frame.setRingRows(true);
+    randomPixels(frame);
+    if(frame.getRingRows() && random(2))
+      frame.scrollY(random(5));
+
+    int left = random(frame.width), top = random(frame.height);
+    int width = random(4) ? 1 + random(frame.width - left) : 0;
+    int height = random(4) ? 1 + random(frame.height - top) : 0;
+    if(random(5) == 0)
+      left = top = width = height = 0; // whole frame
+    int dx = random(9) - 4, dy = random(9) - 4;
+    if(random(10) == 0)
+      dx = random(80) - 40;
+    bool wrap = random(2);
+
+    DMD_Timeline timeline(frame);
+    CHECK_EQUAL(timeline.addScroll(20, dx, dy, wrap, left, top, width, height), 0);
+    if(!width)
+      width = frame.width - left;
+    if(!height)
+      height = frame.height - top;
+
+    Pixels expected = grab(frame);
+    unsigned long now = 1000;
+    timeline.tick(now);
+    if(grab(frame) != expected)
+      mismatches++;
+    for(int i = 0; i < 4; i++) {
+      unsigned long before = (now - 1000) / 20;
+      now += random(100);
+      referenceScroll(expected, left, top, width, height, dx, dy, wrap, (now - 1000) / 20 - before);
+      timeline.tick(now);
+      if(grab(frame) != expected) {
+        mismatches++;
+        break;
+      }
+    }
+  }
+  CHECK_EQUAL(mismatches, 0);
+}
+
+static void testBlinkAndFrames()
+{
+  DMDFrame frame(64, 16);
+  DMD_Timeline timeline(frame);
+  DMDFrame element(10, 7);
+  element.fillScreen(true);
+  DMDFrame a(16, 16), b(16, 16), c(16, 16);
+  a.setPixel(0, 0);
+  b.setPixel(1, 1);
+  c.setPixel(2, 2);
+  DMDFrame *frames[] = { &a, &b, &c };
+  int blink = timeline.addBlink(100, element, 3, 2);
+  int animation = timeline.addFrames(50, frames, 3, 40, 0);
+  CHECK_EQUAL(blink, 0);
+  CHECK_EQUAL(animation, 1);
+
+  timeline.tick(0);
+  CHECK(frame.getPixel(3, 2) && frame.getPixel(12, 8) && !frame.getPixel(13, 8));
+  CHECK(frame.getPixel(40, 0));
+  CHECK(!timeline.tick(49));
+  CHECK(timeline.tick(50));
+  CHECK(frame.getPixel(41, 1) && !frame.getPixel(40, 0) && frame.getPixel(3, 2));
+  timeline.tick(100);
+  CHECK(!frame.getPixel(3, 2) && frame.getPixel(42, 2));
+  timeline.tick(250); // blink takes 1 step, frames take 3 steps round to the same frame
+  CHECK(frame.getPixel(3, 2) && frame.getPixel(42, 2));
+  CHECK_EQUAL(timeline.getLateness(animation), 100);
+  CHECK_EQUAL(timeline.getLateness(blink), 50);
+  CHECK(!timeline.tick(251));
+  timeline.tick(450); // blink takes 2 steps, back where it was
+  CHECK(frame.getPixel(3, 2));
+}
+
+// With triple buffering, all the tracks updated by one tick are shown together
+static void testTripleBuffering()
+{
+  VirtualDMD dmd(2, 1);
+  dmd.beginNoTimer();
+  DMDFrame *canvas = dmd.beginTripleBuffering();
+  CHECK(canvas != NULL);
+  if(!canvas)
+    return;
+  DMD_Timeline timeline(*canvas, &dmd);
+  canvas->setPixel(0, 0);
+  timeline.addScroll(10, 1, 0, true);
+  timeline.addScroll(10, 0, 1, true);
+  CHECK(!timeline.tick(0));
+  dmd.commitFrame(true);
+  for(int i = 0; i < 8; i++)
+    dmd.scanDisplay();
+  CHECK(dmd.getShownPixel(0, 0));
+
+  CHECK(timeline.tick(10));
+  CHECK(canvas->getPixel(1, 1));
+  for(int i = 0; i < 8; i++)
+    dmd.scanDisplay();
+  CHECK(dmd.getShownPixel(1, 1) && !dmd.getShownPixel(0, 0) && !dmd.getShownPixel(1, 0));
+  timeline.tick(35);
+  for(int i = 0; i < 8; i++)
+    dmd.scanDisplay();
+  CHECK(dmd.getShownPixel(3, 3));
+  dmd.endTripleBuffering();
+}
+
+int main()
+{
+  randomSeed(48);
+  testCatchUp();
+  testMaxSteps();
+  testPause();
+  testScroll();
+  testBlinkAndFrames();
+  testTripleBuffering();
+  return checkResult();
+}
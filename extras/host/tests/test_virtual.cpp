@@ -0,0 +1,284 @@
+/*
+ Host tests for VirtualDMD, the emulated panel chain
+*/
+#include "DMD2.h"
+#include "host.h"
+#include "check.h"
+
+// Scan all four interleaved row sets, so every panel row has been lit
+static void scanAll(BaseDMD &dmd)
+{
+  for(int i = 0; i < 4; i++)
+    dmd.scanDisplay();
+}
+
+// Count pixels where the reconstructed panels differ from the frame that was scanned out
+static unsigned int shownDifferences(VirtualDMD &dmd, DMDFrame &expected)
+{
+  unsigned int count = 0;
+  for(unsigned int y = 0; y < dmd.height; y++)
+    for(unsigned int x = 0; x < dmd.width; x++)
+      count += dmd.getShownPixel(x, y) != expected.getPixel(x, y);
+  return count;
+}
+
+// As above, only for the panel rows lit by one row select value (ie rows set, set+4, ...)
+static unsigned int rowSetDifferences(VirtualDMD &dmd, DMDFrame &expected, byte set)
+{
+  unsigned int count = 0;
+  for(unsigned int y = set; y < dmd.height; y += 4)
+    for(unsigned int x = 0; x < dmd.width; x++)
+      count += dmd.getShownPixel(x, y) != expected.getPixel(x, y);
+  return count;
+}
+
+static unsigned int frameDifferences(DMDFrame &a, DMDFrame &b)
+{
+  unsigned int count = 0;
+  for(unsigned int y = 0; y < a.height; y++)
+    for(unsigned int x = 0; x < a.width; x++)
+      count += a.getPixel(x, y) != b.getPixel(x, y);
+  return count;
+}
+
+static void randomImage(DMDFrame &frame)
+{
+  for(unsigned int y = 0; y < frame.height; y++)
+    for(unsigned int x = 0; x < frame.width; x++)
+      frame.setPixel(x, y, random(2) ? GRAPHICS_ON : GRAPHICS_OFF);
+}
+
+// The panels show exactly what was drawn, for random images on each geometry
+static void testReconstruction(byte panelsWide, byte panelsHigh)
+{
+  VirtualDMD dmd(panelsWide, panelsHigh);
+  dmd.beginNoTimer();
+  CHECK_EQUAL(dmd.chainLength(), panelsWide * panelsHigh);
+  for(int image = 0; image < 4; image++) {
+    randomImage(dmd);
+    scanAll(dmd);
+    CHECK_EQUAL(shownDifferences(dmd, dmd), 0);
+  }
+
+  // The top left panel of the display is the last one in the chain
+  dmd.clearScreen();
+  dmd.setPixel(1, 2);
+  scanAll(dmd);
+  CHECK(dmd.getPanelPixel(dmd.chainLength() - 1, 1, 2));
+  for(byte chain_pos = 0; chain_pos + 1 < dmd.chainLength(); chain_pos++)
+    CHECK(!dmd.getPanelPixel(chain_pos, 1, 2));
+}
+
+/* In ring rows mode each band of panels is scanned out through the row offset, and shows
+   the same as a frame that moved its pixels to scroll */
+static void testRingRows(byte panelsWide, byte panelsHigh)
+{
+  VirtualDMD dmd(panelsWide, panelsHigh);
+  dmd.beginNoTimer();
+  DMDFrame expected(dmd.width, dmd.height);
+  randomImage(expected);
+  dmd.copyFrame(expected, 0, 0);
+  dmd.setRingRows(true);
+  for(int step = 0; step < 20; step++) {
+    int scroll_by = random(1 - (int)dmd.height, dmd.height);
+    dmd.scrollY(scroll_by);
+    expected.scrollY(scroll_by);
+    int x = random(dmd.width), y = random(dmd.height);
+    dmd.setPixel(x, y);
+    expected.setPixel(x, y);
+    CHECK_EQUAL(frameDifferences(dmd, expected), 0);
+    scanAll(dmd);
+    CHECK_EQUAL(shownDifferences(dmd, expected), 0);
+  }
+}
+
+// Count pixels where the panels differ from the part of a canvas at x,y
+static unsigned int viewDifferences(VirtualDMD &dmd, DMDFrame &canvas, unsigned int x, unsigned int y)
+{
+  unsigned int count = 0;
+  for(unsigned int row = 0; row < dmd.height; row++)
+    for(unsigned int col = 0; col < dmd.width; col++)
+      count += dmd.getShownPixel(col, row) != canvas.getPixel(x + col, y + row);
+  return count;
+}
+
+/* The panels show the part of a bigger canvas inside the viewport, at every sub-byte shift
+   and at random offsets (including the far edges of the canvas), with the canvas rows in
+   order or as a ring */
+static void testCanvas(byte panelsWide, byte panelsHigh, bool ring_rows)
+{
+  VirtualDMD dmd(panelsWide, panelsHigh);
+  dmd.beginNoTimer();
+  DMDFrame canvas(dmd.width + 45, dmd.height + 13);
+  randomImage(canvas);
+  if(ring_rows) {
+    canvas.setRingRows(true);
+    canvas.scrollY(-9);
+  }
+  CHECK(dmd.setCanvas(&canvas));
+  for(int n = 0; n < 40; n++) {
+    unsigned int x, y;
+    if(n < 8) {
+      x = n;
+      y = n;
+    } else if(n == 8) {
+      x = canvas.width - dmd.width;
+      y = canvas.height - dmd.height;
+    } else {
+      x = random(canvas.width - dmd.width + 1);
+      y = random(canvas.height - dmd.height + 1);
+    }
+    dmd.setViewport(x, y);
+    CHECK(dmd.canvasPending());
+    scanAll(dmd); // takes effect at row set 0...
+    CHECK(!dmd.canvasPending());
+    scanAll(dmd); // ...then every row set is from the new position
+    CHECK_EQUAL(viewDifferences(dmd, canvas, x, y), 0);
+  }
+
+  // Back to the display's own bitmap
+  randomImage(dmd);
+  CHECK(dmd.setCanvas(NULL));
+  scanAll(dmd);
+  scanAll(dmd);
+  CHECK_EQUAL(shownDifferences(dmd, dmd), 0);
+}
+
+static unsigned int presented;
+static void countPresented(BaseDMD &)
+{
+  presented++;
+}
+
+// A frame queued part way through a scan is swapped in when scan_row returns to 0
+static void testPresentAtRowZero()
+{
+  VirtualDMD dmd(2, 1);
+  dmd.beginNoTimer();
+  DMDFrame old_image(dmd.width, dmd.height), new_image(dmd.width, dmd.height);
+  randomImage(old_image);
+  randomImage(new_image);
+  dmd.copyFrame(old_image, 0, 0);
+  DMDFrame back(new_image);
+  scanAll(dmd);
+  dmd.scanDisplay(); // beginNoTimer() scanned row set 0, so this is row set 1
+
+  presented = 0;
+  CHECK(dmd.presentAsync(back, countPresented));
+  CHECK(!dmd.presentAsync(back)); // already pending
+  dmd.scanDisplay(); // row sets 2 and 3 still come from the old frame
+  dmd.scanDisplay();
+  CHECK(dmd.presentPending());
+  CHECK_EQUAL(presented, 0);
+  CHECK_EQUAL(rowSetDifferences(dmd, old_image, 2), 0);
+  CHECK_EQUAL(rowSetDifferences(dmd, old_image, 3), 0);
+
+  dmd.scanDisplay(); // row set 0, swaps
+  CHECK(!dmd.presentPending());
+  CHECK_EQUAL(presented, 1);
+  CHECK_EQUAL(rowSetDifferences(dmd, new_image, 0), 0);
+  CHECK_EQUAL(rowSetDifferences(dmd, old_image, 1), 0);
+  scanAll(dmd);
+  CHECK_EQUAL(shownDifferences(dmd, new_image), 0);
+
+  // The back frame now holds the old image, to draw the next frame into
+  CHECK_EQUAL(frameDifferences(back, old_image), 0);
+}
+
+// A back frame in ring rows mode brings its row offset with it when it's presented
+static void testPresentRingRows()
+{
+  VirtualDMD dmd(2, 2);
+  dmd.beginNoTimer();
+  DMDFrame old_image(dmd.width, dmd.height), back(dmd.width, dmd.height);
+  randomImage(old_image);
+  dmd.copyFrame(old_image, 0, 0);
+  scanAll(dmd);
+  randomImage(back);
+  back.setRingRows(true);
+  back.scrollY(-5);
+  back.scrollY(19);
+  DMDFrame new_image(dmd.width, dmd.height);
+  for(unsigned int y = 0; y < back.height; y++)
+    for(unsigned int x = 0; x < back.width; x++)
+      new_image.setPixel(x, y, back.getPixel(x, y) ? GRAPHICS_ON : GRAPHICS_OFF);
+
+  CHECK(dmd.presentAsync(back));
+  scanAll(dmd); // swaps at row set 0...
+  CHECK(!dmd.presentPending());
+  scanAll(dmd); // ...then shows every row set of the new frame
+  CHECK_EQUAL(shownDifferences(dmd, new_image), 0);
+  CHECK_EQUAL(frameDifferences(dmd, new_image), 0);
+  CHECK_EQUAL(frameDifferences(back, old_image), 0);
+}
+
+// A display destroyed while triple buffering frees all three buffers
+static void testTripleBufferingHeap()
+{
+  size_t in_use = host_getHeapInUse();
+  {
+    VirtualDMD dmd(2, 1);
+    dmd.beginNoTimer();
+    DMDFrame *frame = dmd.beginTripleBuffering();
+    CHECK(frame != NULL);
+    randomImage(*frame);
+    dmd.commitFrame();
+    scanAll(dmd);
+    CHECK(host_getHeapInUse() > in_use);
+  }
+  CHECK_EQUAL(host_getHeapInUse(), in_use);
+}
+
+static bool near(float value, float expected)
+{
+  return value > expected - 0.002 && value < expected + 0.002;
+}
+
+// Each of the four row sets is lit for a quarter of the time, scaled by the brightness
+static void testDuty()
+{
+  VirtualDMD dmd(1, 1);
+  dmd.beginNoTimer();
+  host_setMicros(0);
+  dmd.resetTiming();
+  for(int i = 0; i < 400; i++) {
+    dmd.scanDisplay();
+    host_advanceMicros(1000);
+  }
+  for(byte row = 0; row < PANEL_HEIGHT; row++)
+    CHECK(near(dmd.rowDuty(row), 0.25));
+  CHECK_EQUAL(dmd.rowOnTime(0), dmd.rowOnTime(4)); // rows 0,4,8,12 are lit together
+
+  dmd.setBrightness(64);
+  dmd.resetTiming();
+  for(int i = 0; i < 400; i++) {
+    dmd.scanDisplay();
+    host_advanceMicros(1000);
+  }
+  for(byte row = 0; row < PANEL_HEIGHT; row++)
+    CHECK(near(dmd.rowDuty(row), 0.0625));
+}
+
+int main()
+{
+  randomSeed(28);
+  testReconstruction(1, 1);
+  testReconstruction(2, 1);
+  testReconstruction(3, 1);
+  testReconstruction(1, 2);
+  testReconstruction(2, 2);
+  testReconstruction(3, 2);
+  testRingRows(1, 1);
+  testRingRows(2, 1);
+  testRingRows(1, 2);
+  testRingRows(3, 2);
+  testCanvas(1, 1, false);
+  testCanvas(2, 1, false);
+  testCanvas(3, 2, false);
+  testCanvas(2, 2, true);
+  testDuty();
+  testPresentAtRowZero();
+  testPresentRingRows();
+  testTripleBufferingHeap();
+  return checkResult();
+}
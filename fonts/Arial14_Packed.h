@@ -0,0 +1,148 @@
+
+
+/*
+ *
+ * Arial14_Packed
+ *
+ * DMD2 packed font, converted from Arial14.h by extras/fontpack.py
+ * (see there for the format)
+ *
+ * Font size in bytes  : 965 (1200 unpacked)
+ * Font width          : 10
+ * Font height         : 14
+ * Font first char     : 32
+ * Font used chars     : 96
+ */
+
+#include <inttypes.h>
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#elif defined (ESP8266)
+#include <pgmspace.h>
+#else
+#define PROGMEM
+#endif
+
+#ifndef ARIAL14_PACKED_H
+#define ARIAL14_PACKED_H
+
+static const uint8_t Arial14_Packed[] PROGMEM = {
+    0xFF, 0xFF, // packed font
+    0x0A, // width
+    0x0E, // height
+    0x20, // first char
+    0x60, // char count
+
+    // char widths
+    0x00, 0x01, 0x03, 0x08, 0x07, 0x0A, 0x08, 0x01, 0x03, 0x03,
+    0x05, 0x07, 0x01, 0x04, 0x01, 0x04, 0x06, 0x03, 0x06, 0x06,
+    0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x01, 0x01, 0x06, 0x06,
+    0x06, 0x06, 0x0D, 0x09, 0x07, 0x08, 0x08, 0x07, 0x07, 0x09,
+    0x07, 0x01, 0x05, 0x08, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09,
+    0x08, 0x07, 0x07, 0x07, 0x09, 0x0D, 0x08, 0x09, 0x08, 0x02,
+    0x04, 0x02, 0x05, 0x08, 0x02, 0x06, 0x06, 0x05, 0x06, 0x06,
+    0x04, 0x06, 0x06, 0x01, 0x02, 0x06, 0x01, 0x09, 0x06, 0x06,
+    0x06, 0x06, 0x04, 0x05, 0x04, 0x06, 0x07, 0x09, 0x06, 0x07,
+    0x06, 0x03, 0x01, 0x03, 0x07, 0x07,
+
+    // glyphs: top row, rows, column bits
+    0x00, 0x00, // 32
+    0x01, 0x0A, 0xFF, 0x02, // 33
+    0x01, 0x04, 0x0F, 0x0F, // 34
+    0x01, 0x0A, 0x48, 0x20, 0xCF, 0xC7, 0x12, 0xC8, 0xF3, 0xB1, 0x04, 0x12, // 35
+    0x00, 0x0C, 0x18, 0x42, 0x42, 0x22, 0xF4, 0xFF, 0x42, 0x24, 0x24, 0x84, 0x01, // 36
+    0x01, 0x0A, 0x0E, 0x44, 0x10, 0xA1, 0x63, 0x60, 0x60, 0x60, 0x5C, 0x88, 0x20, 0x02, 0x07, // 37
+    0x01, 0x0A, 0xC0, 0xB9, 0x18, 0x61, 0x8C, 0x49, 0x1A, 0x06, 0x14, 0x80, // 38
+    0x01, 0x04, 0x0F, // 39
+    0x01, 0x0D, 0xF8, 0xC3, 0x80, 0x05, 0x40, // 40
+    0x01, 0x0D, 0x01, 0xD0, 0x80, 0xE1, 0x0F, // 41
+    0x01, 0x04, 0xA2, 0xA7, 0x02, // 42
+    0x03, 0x07, 0x08, 0x04, 0xE2, 0x8F, 0x40, 0x20, 0x00, // 43
+    0x0A, 0x03, 0x07, // 44
+    0x07, 0x01, 0x0F, // 45
+    0x0A, 0x01, 0x01, // 46
+    0x01, 0x0A, 0x00, 0x83, 0xC3, 0xC1, 0x00, // 47
+    0x01, 0x0A, 0xFE, 0x05, 0x18, 0x60, 0x80, 0x01, 0xFA, 0x07, // 48
+    0x01, 0x0A, 0x04, 0x08, 0xF0, 0x3F, // 49
+    0x01, 0x0A, 0x06, 0x06, 0x1C, 0x68, 0x90, 0x21, 0x7A, 0x08, // 50
+    0x01, 0x0A, 0x86, 0x05, 0x18, 0x61, 0x84, 0x11, 0xBA, 0x07, // 51
+    0x01, 0x0A, 0xC0, 0x80, 0x82, 0x09, 0x21, 0x82, 0xFC, 0x0F, 0x08, // 52
+    0x01, 0x0A, 0x9C, 0x2D, 0x98, 0x60, 0x82, 0x09, 0xC7, 0x03, // 53
+    0x01, 0x0A, 0xFC, 0x89, 0x18, 0x61, 0x84, 0x11, 0x8A, 0x07, // 54
+    0x01, 0x0A, 0x01, 0x04, 0x10, 0x78, 0x1C, 0x0D, 0x0C, 0x00, // 55
+    0x01, 0x0A, 0xEE, 0x45, 0x18, 0x61, 0x84, 0x11, 0xBA, 0x07, // 56
+    0x01, 0x0A, 0x1E, 0x85, 0x18, 0x62, 0x88, 0x11, 0xF9, 0x03, // 57
+    0x03, 0x08, 0x81, // 58
+    0x03, 0x0A, 0x81, 0x03, // 59
+    0x03, 0x07, 0x08, 0x0A, 0x45, 0x24, 0x0A, 0x02, // 60
+    0x04, 0x04, 0x99, 0x99, 0x99, // 61
+    0x03, 0x07, 0x41, 0x91, 0x88, 0x42, 0x41, 0x00, // 62
+    0x01, 0x0A, 0x06, 0x04, 0x10, 0x6C, 0x08, 0x11, 0x38, 0x00, // 63
+    0x01, 0x0D, 0xF0, 0x81, 0xC1, 0x08, 0x20, 0xF1, 0x14, 0x21, 0x13, 0x64, 0x82, 0x4C, 0x88, 0xD1, 0x33, 0x47, 0x0A, 0x28, 0xC2, 0x84, 0x47, 0x00, // 64
+    0x01, 0x0A, 0x00, 0x03, 0x03, 0x87, 0x13, 0x41, 0x38, 0x01, 0x07, 0x30, 0x00, 0x03, // 65
+    0x01, 0x0A, 0xFF, 0x47, 0x18, 0x61, 0x84, 0x11, 0x46, 0xE8, 0x1E, // 66
+    0x01, 0x0A, 0xFC, 0x08, 0x14, 0x60, 0x80, 0x01, 0x06, 0x28, 0x10, 0x21, // 67
+    0x01, 0x0A, 0xFF, 0x07, 0x18, 0x60, 0x80, 0x01, 0x06, 0x28, 0x10, 0x3F, // 68
+    0x01, 0x0A, 0xFF, 0x47, 0x18, 0x61, 0x84, 0x11, 0x46, 0x18, 0x21, // 69
+    0x01, 0x0A, 0xFF, 0x47, 0x10, 0x41, 0x04, 0x11, 0x44, 0x10, 0x00, // 70
+    0x01, 0x0A, 0xFC, 0x08, 0x14, 0x60, 0x80, 0x01, 0x86, 0x18, 0xA2, 0x48, 0xE4, 0x00, // 71
+    0x01, 0x0A, 0xFF, 0x43, 0x00, 0x01, 0x04, 0x10, 0x40, 0xF0, 0x3F, // 72
+    0x01, 0x0A, 0xFF, 0x03, // 73
+    0x01, 0x0A, 0x80, 0x01, 0x08, 0x20, 0x80, 0xFF, 0x01, // 74
+    0x01, 0x0A, 0xFF, 0x03, 0x01, 0x02, 0x04, 0x28, 0x10, 0x23, 0x50, 0x80, // 75
+    0x01, 0x0A, 0xFF, 0x03, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, // 76
+    0x01, 0x0A, 0xFF, 0x1B, 0x80, 0x01, 0x38, 0x00, 0x83, 0x83, 0x81, 0x01, 0xFF, 0x03, // 77
+    0x01, 0x0A, 0xFF, 0x0B, 0xC0, 0x00, 0x0C, 0xC0, 0x00, 0xF4, 0x3F, // 78
+    0x01, 0x0A, 0xFC, 0x08, 0x14, 0x60, 0x80, 0x01, 0x06, 0x18, 0xA0, 0x40, 0xFC, 0x00, // 79
+    0x01, 0x0A, 0xFF, 0x87, 0x10, 0x42, 0x08, 0x21, 0x84, 0xE0, 0x01, // 80
+    0x01, 0x0A, 0xFC, 0x08, 0x14, 0x60, 0x80, 0x01, 0x06, 0x1A, 0x90, 0xE0, 0x7C, 0x02, // 81
+    0x01, 0x0A, 0xFF, 0x87, 0x10, 0x42, 0x08, 0x61, 0x84, 0x12, 0x92, 0x87, // 82
+    0x01, 0x0A, 0x8E, 0x45, 0x18, 0x61, 0x84, 0x21, 0x86, 0x68, 0x1C, // 83
+    0x01, 0x0A, 0x01, 0x04, 0x10, 0xC0, 0xFF, 0x01, 0x04, 0x10, 0x00, // 84
+    0x01, 0x0A, 0xFF, 0x00, 0x04, 0x20, 0x80, 0x00, 0x02, 0xF4, 0x0F, // 85
+    0x01, 0x0A, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, // 86
+    0x01, 0x0A, 0x03, 0x70, 0x00, 0x0E, 0xC0, 0xE0, 0x78, 0x10, 0x80, 0x07, 0xE0, 0x00, 0x0C, 0x0E, 0x07, 0x03, 0x00, // 87
+    0x01, 0x0A, 0x01, 0x1A, 0x86, 0x04, 0x0C, 0x30, 0x20, 0x63, 0x58, 0x80, // 88
+    0x01, 0x0A, 0x01, 0x08, 0xC0, 0x00, 0x04, 0xE0, 0x43, 0xC0, 0x80, 0x00, 0x01, 0x00, // 89
+    0x01, 0x0A, 0x00, 0x06, 0x1C, 0x6C, 0x88, 0x11, 0x36, 0x38, 0x60, 0x80, // 90
+    0x01, 0x0D, 0xFF, 0x3F, 0x00, 0x02, // 91
+    0x01, 0x0A, 0x03, 0x70, 0x00, 0x0E, 0xC0, // 92
+    0x01, 0x0D, 0x01, 0xF0, 0xFF, 0x03, // 93
+    0x01, 0x05, 0xD0, 0x05, 0x07, 0x01, // 94
+    0x0D, 0x01, 0xFF, // 95
+    0x01, 0x02, 0x09, // 96
+    0x03, 0x08, 0x62, 0x91, 0x89, 0x89, 0x49, 0xFE, // 97
+    0x01, 0x0A, 0xFF, 0x23, 0x44, 0x20, 0x81, 0x04, 0xE2, 0x07, // 98
+    0x03, 0x08, 0x7E, 0x81, 0x81, 0x81, 0x42, // 99
+    0x01, 0x0A, 0xF8, 0x11, 0x48, 0x20, 0x81, 0x08, 0xFD, 0x0F, // 100
+    0x03, 0x08, 0x7E, 0x89, 0x89, 0x89, 0x89, 0x4E, // 101
+    0x01, 0x0A, 0x04, 0xF8, 0x5F, 0x40, 0x01, // 102
+    0x03, 0x0B, 0x7E, 0x0A, 0x64, 0x20, 0x03, 0x29, 0xC4, 0xFF, 0x01, // 103
+    0x01, 0x0A, 0xFF, 0x23, 0x40, 0x00, 0x01, 0x04, 0xE0, 0x0F, // 104
+    0x01, 0x0A, 0xFD, 0x03, // 105
+    0x01, 0x0D, 0x00, 0xB0, 0xFF, 0x01, // 106
+    0x01, 0x0A, 0xFF, 0x03, 0x01, 0x02, 0x14, 0x88, 0x11, 0x08, // 107
+    0x01, 0x0A, 0xFF, 0x03, // 108
+    0x03, 0x08, 0xFF, 0x02, 0x01, 0x01, 0xFE, 0x02, 0x01, 0x01, 0xFE, // 109
+    0x03, 0x08, 0xFF, 0x02, 0x01, 0x01, 0x01, 0xFE, // 110
+    0x03, 0x08, 0x7E, 0x81, 0x81, 0x81, 0x81, 0x7E, // 111
+    0x03, 0x0B, 0xFF, 0x17, 0x42, 0x20, 0x02, 0x11, 0x08, 0x3F, 0x00, // 112
+    0x03, 0x0B, 0x7E, 0x08, 0x44, 0x20, 0x02, 0x21, 0x84, 0xFF, 0x03, // 113
+    0x03, 0x08, 0xFF, 0x02, 0x01, 0x01, // 114
+    0x03, 0x08, 0x46, 0x89, 0x89, 0x89, 0x72, // 115
+    0x01, 0x0A, 0x04, 0xFC, 0x4F, 0x20, 0x81, // 116
+    0x03, 0x08, 0x7F, 0x80, 0x80, 0x80, 0x40, 0xFF, // 117
+    0x03, 0x08, 0x03, 0x0C, 0x30, 0xC0, 0x30, 0x0C, 0x03, // 118
+    0x03, 0x08, 0x03, 0x3C, 0xC0, 0x3C, 0x03, 0x3C, 0xC0, 0x3C, 0x03, // 119
+    0x03, 0x08, 0x81, 0x66, 0x18, 0x18, 0x66, 0x81, // 120
+    0x03, 0x0B, 0x03, 0x60, 0x20, 0x1C, 0x01, 0x07, 0x07, 0x06, 0x0C, 0x00, // 121
+    0x03, 0x08, 0x81, 0xC1, 0xB1, 0x8D, 0x83, 0x81, // 122
+    0x01, 0x0D, 0x40, 0xC0, 0xF7, 0x05, 0x40, // 123
+    0x01, 0x0D, 0xFF, 0x1F, // 124
+    0x01, 0x0D, 0x01, 0xD0, 0xF7, 0x01, 0x01, // 125
+    0x05, 0x02, 0xD6, 0x1A, // 126
+    0x02, 0x09, 0xFF, 0x03, 0x06, 0x0C, 0x18, 0x30, 0xE0, 0x7F // 127
+
+};
+
+#endif
@@ -0,0 +1,148 @@
+
+
+/*
+ *
+ * Arial_Black_16_Packed
+ *
+ * DMD2 packed font, converted from Arial_Black_16.h by extras/fontpack.py
+ * (see there for the format)
+ *
+ * Font size in bytes  : 1383 (1642 unpacked)
+ * Font width          : 10
+ * Font height         : 16
+ * Font first char     : 32
+ * Font used chars     : 96
+ */
+
+#include <inttypes.h>
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#elif defined (ESP8266)
+#include <pgmspace.h>
+#else
+#define PROGMEM
+#endif
+
+#ifndef ARIAL_BLACK_16_PACKED_H
+#define ARIAL_BLACK_16_PACKED_H
+
+static const uint8_t Arial_Black_16_Packed[] PROGMEM = {
+    0xFF, 0xFF, // packed font
+    0x0A, // width
+    0x10, // height
+    0x20, // first char
+    0x60, // char count
+
+    // char widths
+    0x00, 0x03, 0x07, 0x0B, 0x09, 0x0E, 0x0B, 0x03, 0x05, 0x05,
+    0x06, 0x09, 0x03, 0x05, 0x03, 0x04, 0x08, 0x06, 0x08, 0x08,
+    0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x03, 0x03, 0x09, 0x08,
+    0x09, 0x08, 0x0C, 0x0C, 0x09, 0x09, 0x09, 0x09, 0x08, 0x0A,
+    0x0A, 0x03, 0x09, 0x0C, 0x08, 0x0C, 0x0A, 0x0A, 0x09, 0x0A,
+    0x0A, 0x09, 0x0B, 0x0A, 0x0C, 0x10, 0x0C, 0x0B, 0x09, 0x05,
+    0x04, 0x05, 0x08, 0x08, 0x03, 0x09, 0x09, 0x09, 0x09, 0x09,
+    0x06, 0x09, 0x09, 0x03, 0x04, 0x0A, 0x03, 0x0D, 0x09, 0x09,
+    0x09, 0x09, 0x06, 0x08, 0x06, 0x09, 0x09, 0x0F, 0x0B, 0x09,
+    0x07, 0x06, 0x02, 0x06, 0x09, 0x08,
+
+    // glyphs: top row, rows, column bits
+    0x00, 0x00, // 32
+    0x01, 0x0C, 0xFF, 0xFE, 0xEF, 0xFF, 0x0E, // 33
+    0x01, 0x04, 0xFF, 0x0F, 0xFF, 0x0F, // 34
+    0x01, 0x0C, 0x18, 0x83, 0xF1, 0xF8, 0xFF, 0x3F, 0x1F, 0x83, 0x31, 0x18, 0x8F, 0xFF, 0xFF, 0xF3, 0x31, 0x18, 0x03, // 35
+    0x00, 0x0E, 0x38, 0x04, 0x1F, 0xE3, 0xCF, 0x99, 0x63, 0xFF, 0xBF, 0x71, 0xE6, 0xFC, 0x31, 0x3E, 0x0C, 0x07, // 36
+    0x01, 0x0C, 0x1E, 0xF0, 0x03, 0x21, 0x10, 0x82, 0x3F, 0xE6, 0x11, 0xC0, 0x00, 0x03, 0x88, 0x67, 0xFC, 0x41, 0x08, 0x84, 0xC0, 0x0F, 0x78, // 37
+    0x01, 0x0C, 0x80, 0x03, 0x7C, 0xCE, 0xFF, 0xCF, 0x7F, 0x3C, 0xCF, 0xDF, 0xFF, 0x79, 0xCE, 0x07, 0xFC, 0xC0, 0x0E, // 38
+    0x01, 0x04, 0xFF, 0x0F, // 39
+    0x01, 0x0F, 0xF0, 0x07, 0xFE, 0x8F, 0xFF, 0xEF, 0x01, 0x1F, 0x00, 0x04, // 40
+    0x01, 0x0F, 0x01, 0xC0, 0x07, 0xBC, 0xFF, 0x8F, 0xFF, 0x03, 0x7F, 0x00, // 41
+    0x01, 0x06, 0x04, 0xFD, 0x7D, 0x34, 0x01, // 42
+    0x03, 0x09, 0x38, 0x70, 0xE0, 0xF8, 0xFF, 0xFF, 0x3F, 0x0E, 0x1C, 0x38, 0x00, // 43
+    0x0A, 0x06, 0xF7, 0xF7, 0x00, // 44
+    0x07, 0x03, 0xFF, 0x7F, // 45
+    0x0A, 0x03, 0xFF, 0x01, // 46
+    0x01, 0x0C, 0x00, 0x0C, 0x3C, 0x3C, 0x30, 0x00, // 47
+    0x01, 0x0C, 0xFC, 0xE3, 0x7F, 0xFF, 0x3F, 0xC0, 0x03, 0xFC, 0xFF, 0xFE, 0xC7, 0x3F, // 48
+    0x01, 0x0C, 0x30, 0x80, 0x03, 0x1C, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, // 49
+    0x01, 0x0C, 0x0C, 0xEC, 0xE0, 0x0F, 0x3F, 0xF8, 0xC3, 0xFD, 0xCF, 0x7E, 0xCC, 0xC3, // 50
+    0x01, 0x0C, 0x04, 0xE3, 0x70, 0x0F, 0x3F, 0xC6, 0x63, 0xFC, 0xFF, 0xFE, 0xC7, 0x39, // 51
+    0x01, 0x0C, 0xC0, 0x01, 0x1E, 0xF8, 0xC1, 0x19, 0x8E, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, // 52
+    0x01, 0x0C, 0x78, 0xF3, 0x77, 0x7F, 0x3F, 0xC3, 0x33, 0x3C, 0xFF, 0xE3, 0x37, 0x3C, // 53
+    0x01, 0x0C, 0xF8, 0xE1, 0x7F, 0xFF, 0x3F, 0xC2, 0x33, 0x7C, 0xFF, 0xE7, 0x67, 0x3C, // 54
+    0x01, 0x0C, 0x03, 0x30, 0x00, 0x03, 0x3E, 0xFC, 0xF3, 0xBF, 0x0F, 0x0F, 0x30, 0x00, // 55
+    0x01, 0x0C, 0x9C, 0xE3, 0x7F, 0xFF, 0x3F, 0xC6, 0x63, 0xFC, 0xFF, 0xFE, 0xC7, 0x39, // 56
+    0x01, 0x0C, 0x3C, 0xE2, 0x67, 0xFF, 0x3E, 0xCC, 0x43, 0xFC, 0xFF, 0xFE, 0x87, 0x1F, // 57
+    0x04, 0x09, 0xC7, 0x8F, 0x1F, 0x07, // 58
+    0x04, 0x0C, 0xC7, 0x7D, 0x7C, 0xC7, 0x03, // 59
+    0x03, 0x09, 0x7C, 0xF8, 0xF0, 0xF1, 0xE7, 0xCE, 0x9D, 0xBB, 0xE3, 0xC7, 0x01, // 60
+    0x04, 0x07, 0xF7, 0xFB, 0xFD, 0x7E, 0xBF, 0xDF, 0xEF, // 61
+    0x03, 0x09, 0xC7, 0x8F, 0xBB, 0x73, 0xE7, 0xCE, 0x1F, 0x1F, 0x3E, 0x7C, 0x00, // 62
+    0x01, 0x0C, 0x0C, 0xE0, 0x00, 0xCF, 0x3E, 0xEE, 0xF3, 0xFE, 0x07, 0x3E, 0xC0, 0x01, // 63
+    0x01, 0x0E, 0xF0, 0x03, 0x03, 0x23, 0x3E, 0xE9, 0x5F, 0x1D, 0x64, 0x01, 0x59, 0x60, 0xE6, 0x9F, 0xFD, 0xA7, 0x0F, 0x45, 0xB0, 0xE1, 0x23, // 64
+    0x01, 0x0C, 0x00, 0x0E, 0xFC, 0xF0, 0xC7, 0x3F, 0x7F, 0xF3, 0x30, 0x7F, 0xC3, 0x3F, 0xF0, 0x07, 0xFC, 0x00, 0x0E, 0x80, // 65
+    0x01, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xC6, 0x63, 0xFC, 0xC7, 0xDE, 0xCF, 0x7C, 0x80, 0x03, // 66
+    0x01, 0x0C, 0xF8, 0xE1, 0x7F, 0xFE, 0x7F, 0xE0, 0x03, 0x7C, 0xE0, 0x8F, 0xEF, 0x70, 0x04, 0x03, // 67
+    0x01, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xC0, 0x03, 0x7C, 0xE0, 0xFF, 0xEF, 0x7F, 0xF8, 0x01, // 68
+    0x01, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xC6, 0x63, 0x3C, 0xC6, 0x63, 0x3C, 0xC6, 0x03, 0x0C, // 69
+    0x01, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x06, 0x63, 0x30, 0x06, 0x63, 0x30, 0x00, // 70
+    0x01, 0x0C, 0xF8, 0xE1, 0x7F, 0xFE, 0x77, 0xE0, 0x03, 0x3C, 0xC6, 0x67, 0xFE, 0xFE, 0xEE, 0x47, 0x7E, // 71
+    0x01, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x06, 0x60, 0x00, 0x06, 0x60, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, // 72
+    0x01, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, // 73
+    0x01, 0x0C, 0x00, 0x03, 0x78, 0x80, 0x0F, 0xE0, 0x00, 0x0C, 0xC0, 0xFF, 0xFF, 0x7F, 0xFF, 0x03, // 74
+    0x01, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x06, 0x70, 0x80, 0x07, 0xFC, 0xE0, 0x3E, 0x87, 0x3F, 0xF0, 0x01, 0x0C, 0x80, // 75
+    0x01, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xC0, 0x00, 0x0C, 0xC0, 0x00, 0x0C, 0xC0, // 76
+    0x01, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFC, 0x01, 0xFC, 0xC0, 0xCF, 0x1F, 0x1F, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, // 77
+    0x01, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, // 78
+    0x01, 0x0C, 0xF8, 0xE1, 0x7F, 0xFE, 0x77, 0xE0, 0x03, 0x3C, 0xC0, 0x07, 0xEE, 0x7F, 0xFE, 0x87, 0x1F, // 79
+    0x01, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x06, 0x63, 0x30, 0x06, 0x7F, 0xF0, 0x03, 0x1E, 0x00, // 80
+    0x01, 0x0D, 0xF8, 0xC1, 0xFF, 0xF8, 0x9F, 0x03, 0x37, 0xC0, 0x06, 0xDE, 0x81, 0xF3, 0x7F, 0xFE, 0x0F, 0x3F, 0x03, // 81
+    0x01, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x06, 0x63, 0x30, 0x1E, 0xFF, 0xF7, 0xFB, 0x1E, 0x0E, 0x80, // 82
+    0x01, 0x0C, 0x1C, 0xE3, 0x73, 0x7F, 0x3F, 0xE7, 0x73, 0x7C, 0xCF, 0xEF, 0xEF, 0x7E, 0xCC, 0x03, // 83
+    0x01, 0x0C, 0x03, 0x30, 0x00, 0x03, 0x30, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x03, 0x30, 0x00, 0x03, 0x00, // 84
+    0x01, 0x0C, 0xFF, 0xF3, 0x7F, 0xFF, 0x0F, 0xE0, 0x00, 0x0C, 0xC0, 0x00, 0xFE, 0xFF, 0xFF, 0xF7, 0x3F, // 85
+    0x01, 0x0C, 0x0F, 0xF0, 0x07, 0xFE, 0x81, 0xFF, 0xC0, 0x0F, 0xE0, 0xC0, 0x8F, 0xFF, 0xFE, 0xF1, 0x07, 0x0F, 0x10, 0x00, // 86
+    0x01, 0x0C, 0x7F, 0xF0, 0x7F, 0xFC, 0x0F, 0xF8, 0xC0, 0xCF, 0x3F, 0xFF, 0xF0, 0x01, 0xFF, 0xC0, 0x3F, 0xC0, 0x0F, 0xF8, 0xFC, 0xFF, 0x7F, 0x7F, 0x30, 0x00, // 87
+    0x01, 0x0C, 0x03, 0xFC, 0xF0, 0x9E, 0xC7, 0x3F, 0xF8, 0x01, 0x0F, 0xF8, 0xC1, 0x3F, 0x9E, 0xF7, 0xF0, 0x03, 0x1C, 0x80, // 88
+    0x01, 0x0C, 0x01, 0x70, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x0F, 0xFF, 0xFC, 0xFF, 0x03, 0x0F, 0x70, 0x00, 0x01, 0x00, // 89
+    0x01, 0x0C, 0x00, 0x3E, 0xF0, 0x83, 0x3F, 0xDE, 0xF3, 0xBC, 0xC7, 0x1F, 0xFC, 0xC0, 0x07, 0x0C, // 90
+    0x01, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x3C, 0x00, 0x06, // 91
+    0x01, 0x0C, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, // 92
+    0x01, 0x0F, 0x03, 0xE0, 0x01, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, // 93
+    0x01, 0x06, 0x20, 0xEE, 0x3F, 0x8F, 0x8F, 0x83, // 94
+    0x0E, 0x01, 0xFF, // 95
+    0x01, 0x02, 0x2D, // 96
+    0x04, 0x09, 0xE4, 0xEC, 0xDF, 0x9F, 0xBD, 0x79, 0xD3, 0xFF, 0xFF, 0xFE, 0x01, // 97
+    0x01, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x63, 0x18, 0x8C, 0xC1, 0xF8, 0x0F, 0x7F, 0xE0, 0x03, // 98
+    0x04, 0x09, 0x7C, 0xFC, 0xFD, 0x3F, 0x3E, 0x78, 0xF0, 0x71, 0x63, 0x44, 0x00, // 99
+    0x01, 0x0C, 0xE0, 0x03, 0x7F, 0xF8, 0x8F, 0xC1, 0x18, 0x0C, 0x63, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, // 100
+    0x04, 0x09, 0x7C, 0xFC, 0xFD, 0xDF, 0xBE, 0x79, 0xF3, 0x77, 0x6F, 0x5C, 0x00, // 101
+    0x01, 0x0C, 0x18, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x1B, 0xB0, 0x01, // 102
+    0x04, 0x0C, 0x7C, 0xE4, 0xCF, 0xFF, 0x3D, 0xD8, 0x83, 0x6D, 0xCC, 0xFF, 0xFF, 0x7F, 0xFF, 0x03, // 103
+    0x01, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x01, 0x18, 0x80, 0x01, 0xF8, 0x8F, 0xFF, 0xF0, 0x0F, // 104
+    0x01, 0x0C, 0xFB, 0xBF, 0xFF, 0xFB, 0x0F, // 105
+    0x01, 0x0F, 0x00, 0xE0, 0xFD, 0xFF, 0xFE, 0x7F, 0xFF, 0x07, // 106
+    0x01, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x1E, 0xF0, 0x80, 0x3F, 0xF8, 0x8F, 0xF1, 0x08, 0x0E, 0x80, // 107
+    0x01, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, // 108
+    0x04, 0x09, 0xFF, 0xFF, 0xFF, 0x17, 0x30, 0xE0, 0xFF, 0x7F, 0xFF, 0x02, 0x06, 0xFC, 0xFF, 0xEF, 0x1F, // 109
+    0x04, 0x09, 0xFF, 0xFF, 0xFF, 0x17, 0x30, 0x60, 0xC0, 0xFF, 0xFF, 0xFE, 0x01, // 110
+    0x04, 0x09, 0x7C, 0xFC, 0xFD, 0x3F, 0x3E, 0xF8, 0xF8, 0x7F, 0x7F, 0x7C, 0x00, // 111
+    0x04, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x0C, 0x83, 0x71, 0x18, 0xFF, 0xE1, 0x0F, 0x7C, 0x00, // 112
+    0x04, 0x0C, 0x7C, 0xE0, 0x0F, 0xFF, 0x31, 0x18, 0x83, 0x61, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, // 113
+    0x04, 0x09, 0xFF, 0xFF, 0xFF, 0x17, 0x30, 0x20, 0x00, // 114
+    0x04, 0x09, 0x8E, 0x3E, 0xFF, 0xCE, 0x99, 0x73, 0xFF, 0x7C, 0x71, // 115
+    0x01, 0x0C, 0x18, 0xE0, 0x7F, 0xFE, 0xFF, 0xFF, 0x18, 0x8C, 0xC1, // 116
+    0x04, 0x09, 0xFF, 0xFE, 0xFF, 0x07, 0x0C, 0x18, 0xD0, 0xFF, 0xFF, 0xFF, 0x01, // 117
+    0x04, 0x09, 0x01, 0x1E, 0xFC, 0xE1, 0x0F, 0xDC, 0xFF, 0x9F, 0x07, 0x01, 0x00, // 118
+    0x04, 0x09, 0x01, 0x1E, 0xFC, 0xF1, 0x0F, 0x1E, 0xDE, 0x8F, 0x07, 0x3F, 0xE0, 0x81, 0xF7, 0xFF, 0xE7, 0x41, 0x00, // 119
+    0x04, 0x09, 0x01, 0x07, 0x9F, 0xF7, 0xC7, 0x07, 0x07, 0x1F, 0x7F, 0xE7, 0x07, 0x07, 0x04, // 120
+    0x04, 0x0C, 0x01, 0xFC, 0xC0, 0x7F, 0xCC, 0xFF, 0xC0, 0xCF, 0x3F, 0xFF, 0xF0, 0x01, 0x03, 0x00, // 121
+    0x04, 0x09, 0xC3, 0xC7, 0xCF, 0xFF, 0xFD, 0xF9, 0xF1, 0x60, // 122
+    0x01, 0x0F, 0x80, 0x01, 0xC0, 0x80, 0xFF, 0xEF, 0xFF, 0xFF, 0xE7, 0x1F, 0x00, 0x03, // 123
+    0x01, 0x0F, 0xFF, 0xFF, 0xFF, 0x3F, // 124
+    0x01, 0x0F, 0x03, 0xE0, 0x3F, 0xFF, 0xFF, 0xDF, 0xFF, 0x07, 0x18, 0x00, 0x0C, 0x00, // 125
+    0x05, 0x04, 0x7E, 0x77, 0xEF, 0xEE, 0x07, // 126
+    0x03, 0x0A, 0xFF, 0x07, 0x18, 0x60, 0x80, 0x01, 0x06, 0x18, 0xE0, 0xFF // 127
+
+};
+
+#endif
@@ -0,0 +1,148 @@
+
+
+/*
+ *
+ * Droid_Sans_12_Packed
+ *
+ * DMD2 packed font, converted from Droid_Sans_12.h by extras/fontpack.py
+ * (see there for the format)
+ *
+ * Font size in bytes  : 791 (1012 unpacked)
+ * Font width          : 10
+ * Font height         : 12
+ * Font first char     : 32
+ * Font used chars     : 96
+ */
+
+#include <inttypes.h>
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#elif defined (ESP8266)
+#include <pgmspace.h>
+#else
+#define PROGMEM
+#endif
+
+#ifndef DROID_SANS_12_PACKED_H
+#define DROID_SANS_12_PACKED_H
+
+static const uint8_t Droid_Sans_12_Packed[] PROGMEM = {
+    0xFF, 0xFF, // packed font
+    0x0A, // width
+    0x0C, // height
+    0x20, // first char
+    0x60, // char count
+
+    // char widths
+    0x00, 0x01, 0x03, 0x08, 0x05, 0x09, 0x07, 0x01, 0x03, 0x03,
+    0x05, 0x05, 0x02, 0x03, 0x01, 0x04, 0x05, 0x03, 0x05, 0x05,
+    0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x01, 0x02, 0x05, 0x05,
+    0x05, 0x04, 0x08, 0x07, 0x05, 0x06, 0x06, 0x04, 0x05, 0x06,
+    0x06, 0x03, 0x02, 0x06, 0x05, 0x09, 0x07, 0x07, 0x05, 0x07,
+    0x05, 0x05, 0x07, 0x06, 0x07, 0x0B, 0x07, 0x07, 0x05, 0x03,
+    0x04, 0x03, 0x06, 0x05, 0x02, 0x05, 0x05, 0x04, 0x05, 0x05,
+    0x03, 0x05, 0x05, 0x01, 0x02, 0x05, 0x01, 0x09, 0x05, 0x05,
+    0x05, 0x05, 0x03, 0x04, 0x04, 0x05, 0x05, 0x09, 0x04, 0x05,
+    0x04, 0x04, 0x01, 0x04, 0x05, 0x05,
+
+    // glyphs: top row, rows, column bits
+    0x00, 0x00, // 32
+    0x00, 0x09, 0xBF, 0x01, // 33
+    0x00, 0x03, 0xC7, 0x01, // 34
+    0x00, 0x09, 0x24, 0xC8, 0xFB, 0x28, 0x41, 0x9A, 0xCF, 0x09, 0x12, // 35
+    0x00, 0x0A, 0x0C, 0x49, 0xF4, 0xBF, 0x48, 0xE2, 0x00, // 36
+    0x00, 0x09, 0x0E, 0x22, 0x44, 0x76, 0x03, 0x81, 0xDD, 0x44, 0x88, 0xE0, 0x00, // 37
+    0x00, 0x09, 0xE0, 0x3C, 0x66, 0x4C, 0x69, 0x0C, 0x38, 0x48, // 38
+    0x00, 0x03, 0x07, // 39
+    0x00, 0x0B, 0xFC, 0x31, 0x58, 0x00, 0x01, // 40
+    0x00, 0x0B, 0x01, 0x34, 0x18, 0x7F, 0x00, // 41
+    0x00, 0x05, 0x84, 0x1F, 0x4E, 0x00, // 42
+    0x02, 0x05, 0x84, 0x7C, 0x42, 0x00, // 43
+    0x08, 0x03, 0x1E, // 44
+    0x05, 0x01, 0x07, // 45
+    0x07, 0x02, 0x03, // 46
+    0x00, 0x09, 0x80, 0xE1, 0x30, 0x18, 0x00, // 47
+    0x00, 0x09, 0xFE, 0x06, 0x07, 0x1C, 0xEC, 0x0F, // 48
+    0x00, 0x09, 0x02, 0x02, 0xFC, 0x07, // 49
+    0x00, 0x09, 0x02, 0x83, 0x87, 0x8D, 0xE9, 0x10, // 50
+    0x00, 0x09, 0x02, 0x23, 0x46, 0xCC, 0xE8, 0x0E, // 51
+    0x00, 0x09, 0x60, 0xA0, 0x30, 0x11, 0xF2, 0x1F, 0x08, // 52
+    0x00, 0x09, 0x0F, 0x13, 0x26, 0x4C, 0x08, 0x0F, // 53
+    0x00, 0x09, 0xFC, 0x14, 0x27, 0x4C, 0x08, 0x0F, // 54
+    0x00, 0x09, 0x01, 0x02, 0x87, 0xE9, 0x30, 0x00, // 55
+    0x00, 0x09, 0xEE, 0x32, 0x46, 0xCC, 0xE9, 0x0E, // 56
+    0x00, 0x09, 0x1E, 0x42, 0x86, 0x1C, 0xE5, 0x07, // 57
+    0x03, 0x06, 0x33, // 58
+    0x03, 0x08, 0xC0, 0x63, // 59
+    0x02, 0x05, 0x44, 0x29, 0x15, 0x01, // 60
+    0x03, 0x03, 0x6D, 0x5B, // 61
+    0x02, 0x05, 0x51, 0x29, 0x45, 0x00, // 62
+    0x00, 0x09, 0x01, 0x62, 0x67, 0x70, 0x00, // 63
+    0x00, 0x0A, 0xF8, 0x18, 0x94, 0x67, 0xA1, 0x85, 0xF6, 0x2B, 0x08, 0x1F, // 64
+    0x00, 0x09, 0x80, 0xE1, 0xB8, 0x08, 0xE1, 0x02, 0x0E, 0x60, // 65
+    0x00, 0x09, 0xFF, 0x23, 0x46, 0x8C, 0xE8, 0x0E, // 66
+    0x00, 0x09, 0x7C, 0x0C, 0x05, 0x0C, 0x18, 0x30, 0x20, // 67
+    0x00, 0x09, 0xFF, 0x03, 0x06, 0x0C, 0x28, 0x88, 0x0F, // 68
+    0x00, 0x09, 0xFF, 0x23, 0x46, 0x8C, 0x08, // 69
+    0x00, 0x09, 0xFF, 0x23, 0x44, 0x88, 0x10, 0x01, // 70
+    0x00, 0x09, 0x7C, 0x04, 0x05, 0x8C, 0x18, 0x31, 0x3E, // 71
+    0x00, 0x09, 0xFF, 0x21, 0x40, 0x80, 0x00, 0xE1, 0x3F, // 72
+    0x00, 0x09, 0x01, 0xFF, 0x07, 0x04, // 73
+    0x00, 0x0B, 0x00, 0xFC, 0x1F, // 74
+    0x00, 0x09, 0xFF, 0x21, 0x60, 0x20, 0x23, 0x2C, 0x20, // 75
+    0x00, 0x09, 0xFF, 0x01, 0x02, 0x04, 0x08, 0x10, // 76
+    0x00, 0x09, 0xFF, 0x07, 0x70, 0x00, 0x07, 0x18, 0x0C, 0x87, 0x01, 0xFF, 0x01, // 77
+    0x00, 0x09, 0xFF, 0x07, 0x30, 0x80, 0x00, 0x06, 0xF0, 0x7F, // 78
+    0x00, 0x09, 0x7C, 0x04, 0x05, 0x0C, 0x18, 0x50, 0x10, 0x1F, // 79
+    0x00, 0x09, 0xFF, 0x43, 0x84, 0x98, 0xE1, 0x01, // 80
+    0x00, 0x0B, 0x7C, 0x10, 0x44, 0x40, 0x02, 0x12, 0x30, 0x41, 0xF3, 0x01, // 81
+    0x00, 0x09, 0xFF, 0x23, 0x44, 0x88, 0xE7, 0x18, // 82
+    0x00, 0x09, 0x0E, 0x33, 0x46, 0x8C, 0x19, 0x0E, // 83
+    0x00, 0x09, 0x01, 0x02, 0x04, 0xF8, 0x1F, 0x20, 0x40, 0x00, // 84
+    0x00, 0x09, 0xFF, 0x00, 0x03, 0x04, 0x08, 0xF8, 0x1F, // 85
+    0x00, 0x09, 0x03, 0x38, 0x80, 0x03, 0x08, 0x8E, 0xC3, 0x00, // 86
+    0x00, 0x09, 0x07, 0xF0, 0x01, 0x84, 0xE7, 0x20, 0x80, 0x03, 0x78, 0x00, 0xF1, 0x1D, 0x00, // 87
+    0x00, 0x09, 0x01, 0x85, 0xB1, 0xC1, 0xC0, 0x46, 0x58, 0x40, // 88
+    0x00, 0x09, 0x01, 0x0C, 0x60, 0x00, 0x8F, 0xC1, 0x40, 0x00, // 89
+    0x00, 0x09, 0x81, 0xC3, 0xE7, 0x7C, 0x38, 0x10, // 90
+    0x00, 0x0B, 0xFF, 0x0F, 0x60, 0x00, 0x01, // 91
+    0x00, 0x09, 0x03, 0x38, 0x80, 0x01, 0x0C, // 92
+    0x00, 0x0B, 0x01, 0x0C, 0xE0, 0xFF, 0x01, // 93
+    0x00, 0x05, 0x90, 0x8D, 0xC1, 0x20, // 94
+    0x0A, 0x01, 0x1F, // 95
+    0x00, 0x02, 0x09, // 96
+    0x03, 0x06, 0x59, 0x59, 0x96, 0x3E, // 97
+    0x00, 0x09, 0xFF, 0x11, 0x22, 0x44, 0x08, 0x0F, // 98
+    0x03, 0x06, 0x5E, 0x18, 0x86, // 99
+    0x00, 0x09, 0xF0, 0x10, 0x22, 0x44, 0xF8, 0x1F, // 100
+    0x03, 0x06, 0x5E, 0x59, 0x96, 0x26, // 101
+    0x00, 0x09, 0x08, 0xFE, 0x27, 0x00, // 102
+    0x03, 0x09, 0xC6, 0x72, 0xA6, 0x3C, 0x19, 0x0E, // 103
+    0x00, 0x09, 0xFF, 0x11, 0x20, 0x40, 0x00, 0x1F, // 104
+    0x01, 0x08, 0xFD, // 105
+    0x01, 0x0B, 0x00, 0xEC, 0x3F, // 106
+    0x00, 0x09, 0xFF, 0x41, 0xC0, 0xC1, 0x84, 0x10, // 107
+    0x00, 0x09, 0xFF, 0x01, // 108
+    0x03, 0x06, 0x7F, 0x10, 0x04, 0x7E, 0x10, 0x04, 0x3E, // 109
+    0x03, 0x06, 0x7F, 0x10, 0x04, 0x3E, // 110
+    0x03, 0x06, 0x5E, 0x18, 0x86, 0x1E, // 111
+    0x03, 0x09, 0xFF, 0x43, 0x84, 0x08, 0xE1, 0x01, // 112
+    0x03, 0x09, 0x1E, 0x42, 0x84, 0x08, 0xF1, 0x1F, // 113
+    0x03, 0x06, 0x7F, 0x10, 0x00, // 114
+    0x03, 0x06, 0x67, 0x99, 0x66, // 115
+    0x02, 0x07, 0x82, 0xBF, 0x50, 0x08, // 116
+    0x03, 0x06, 0x1F, 0x08, 0x82, 0x3F, // 117
+    0x03, 0x06, 0x03, 0x07, 0x72, 0x03, // 118
+    0x03, 0x06, 0x03, 0x07, 0x7A, 0x81, 0x07, 0x72, 0x03, // 119
+    0x03, 0x06, 0xB3, 0xE7, 0xCD, // 120
+    0x03, 0x09, 0x03, 0x39, 0x82, 0xE3, 0x30, 0x00, // 121
+    0x03, 0x06, 0x71, 0x5E, 0x8E, // 122
+    0x00, 0x0B, 0x20, 0x00, 0xC1, 0xF7, 0x03, 0x08, // 123
+    0x00, 0x0C, 0xFF, 0x0F, // 124
+    0x00, 0x0B, 0x01, 0xFC, 0x3E, 0x08, 0x40, 0x00, // 125
+    0x03, 0x02, 0xB5, 0x02, // 126
+    0x00, 0x09, 0xFF, 0x03, 0x06, 0x0C, 0xF8, 0x1F // 127
+
+};
+
+#endif
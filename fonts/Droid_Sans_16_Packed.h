@@ -0,0 +1,148 @@
+
+
+/*
+ *
+ * Droid_Sans_16_Packed
+ *
+ * DMD2 packed font, converted from Droid_Sans_16.h by extras/fontpack.py
+ * (see there for the format)
+ *
+ * Font size in bytes  : 1190 (1986 unpacked)
+ * Font width          : 10
+ * Font height         : 17
+ * Font first char     : 32
+ * Font used chars     : 96
+ */
+
+#include <inttypes.h>
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#elif defined (ESP8266)
+#include <pgmspace.h>
+#else
+#define PROGMEM
+#endif
+
+#ifndef DROID_SANS_16_PACKED_H
+#define DROID_SANS_16_PACKED_H
+
+static const uint8_t Droid_Sans_16_Packed[] PROGMEM = {
+    0xFF, 0xFF, // packed font
+    0x0A, // width
+    0x11, // height
+    0x20, // first char
+    0x60, // char count
+
+    // char widths
+    0x00, 0x02, 0x05, 0x08, 0x07, 0x0B, 0x0A, 0x02, 0x04, 0x04,
+    0x08, 0x07, 0x03, 0x03, 0x01, 0x06, 0x07, 0x04, 0x07, 0x07,
+    0x09, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x03, 0x07, 0x07,
+    0x07, 0x06, 0x0C, 0x0A, 0x08, 0x09, 0x09, 0x06, 0x06, 0x0A,
+    0x08, 0x04, 0x02, 0x08, 0x07, 0x0B, 0x09, 0x0A, 0x07, 0x0A,
+    0x08, 0x07, 0x08, 0x08, 0x09, 0x0D, 0x08, 0x08, 0x08, 0x03,
+    0x06, 0x03, 0x09, 0x07, 0x03, 0x07, 0x07, 0x06, 0x07, 0x07,
+    0x04, 0x08, 0x07, 0x01, 0x02, 0x07, 0x01, 0x0C, 0x07, 0x07,
+    0x07, 0x07, 0x05, 0x05, 0x05, 0x07, 0x08, 0x0C, 0x08, 0x08,
+    0x06, 0x05, 0x01, 0x05, 0x07, 0x07,
+
+    // glyphs: top row, rows, column bits
+    0x00, 0x00, // 32
+    0x01, 0x0C, 0xFF, 0xFD, 0xCF, // 33
+    0x01, 0x04, 0x1F, 0xF0, 0x01, // 34
+    0x01, 0x0C, 0x80, 0x00, 0xF9, 0xF8, 0xF1, 0x09, 0x90, 0x8F, 0x1F, 0x97, 0x00, 0x01, // 35
+    0x00, 0x0E, 0x38, 0x0C, 0x1B, 0x42, 0x84, 0xFC, 0xFF, 0x84, 0x08, 0x61, 0x43, 0x70, 0x00, // 36
+    0x01, 0x0C, 0x1E, 0x10, 0x02, 0x21, 0x38, 0x63, 0x9E, 0x01, 0x06, 0x98, 0x67, 0x84, 0x41, 0x08, 0xCC, 0x80, 0x07, // 37
+    0x01, 0x0C, 0x80, 0xE7, 0xEC, 0x7B, 0x18, 0x86, 0xF1, 0xB8, 0xD9, 0x0E, 0x07, 0x70, 0xC0, 0x0D, 0x84, // 38
+    0x01, 0x04, 0x1F, // 39
+    0x01, 0x0F, 0xF0, 0x07, 0xBE, 0xDF, 0x01, 0x3C, 0x00, 0x08, // 40
+    0x01, 0x0F, 0x01, 0xC0, 0x03, 0x30, 0xDF, 0x0F, 0xFE, 0x00, // 41
+    0x00, 0x07, 0x0C, 0x06, 0xFE, 0xF3, 0xC1, 0x33, 0x19, // 42
+    0x04, 0x07, 0x08, 0x04, 0xE2, 0x8F, 0x40, 0x20, 0x00, // 43
+    0x0B, 0x04, 0x78, 0x01, // 44
+    0x08, 0x01, 0x07, // 45
+    0x0B, 0x02, 0x03, // 46
+    0x01, 0x0C, 0x00, 0x0C, 0x70, 0xE0, 0x81, 0x03, 0x0F, 0x10, 0x00, // 47
+    0x01, 0x0C, 0xFC, 0xE3, 0x79, 0x03, 0x1C, 0x80, 0x03, 0xEC, 0x79, 0xFC, 0x03, // 48
+    0x01, 0x0C, 0x04, 0x20, 0x00, 0x03, 0xF0, 0xFF, // 49
+    0x01, 0x0C, 0x02, 0x3C, 0xE0, 0x01, 0x1B, 0x98, 0xC1, 0x78, 0x87, 0x1E, 0x08, // 50
+    0x01, 0x0C, 0x02, 0x3C, 0x80, 0x21, 0x18, 0x82, 0x61, 0xBC, 0x6D, 0x8E, 0x03, // 51
+    0x01, 0x0C, 0x80, 0x01, 0x14, 0x30, 0x81, 0x11, 0x0C, 0x21, 0x10, 0xFF, 0x0F, 0x10, 0x00, 0x01, // 52
+    0x01, 0x0C, 0x3F, 0x7C, 0x82, 0x21, 0x18, 0x82, 0x61, 0x1C, 0x6C, 0x80, 0x03, // 53
+    0x01, 0x0C, 0xF8, 0xE3, 0x6F, 0x22, 0x3C, 0x82, 0x21, 0x18, 0x66, 0xC0, 0x03, // 54
+    0x01, 0x0C, 0x01, 0x10, 0xC0, 0x01, 0x17, 0x1C, 0x71, 0xF0, 0x01, 0x03, 0x00, // 55
+    0x01, 0x0C, 0x8E, 0x37, 0xCD, 0x61, 0x18, 0x82, 0x61, 0xB8, 0xCD, 0x8E, 0x07, // 56
+    0x01, 0x0C, 0x3C, 0x70, 0x86, 0x41, 0x18, 0x84, 0x43, 0x64, 0x7F, 0xFC, 0x01, // 57
+    0x04, 0x09, 0x83, 0x01, // 58
+    0x04, 0x0B, 0x00, 0x1C, 0x1C, 0x20, 0x00, // 59
+    0x03, 0x08, 0x18, 0x18, 0x24, 0x24, 0x42, 0x42, 0xC1, // 60
+    0x05, 0x04, 0x99, 0x99, 0x99, 0x09, // 61
+    0x03, 0x08, 0xC1, 0x42, 0x42, 0x24, 0x24, 0x18, 0x18, // 62
+    0x01, 0x0C, 0x02, 0x30, 0x00, 0x81, 0x1D, 0xCC, 0x33, 0xE0, 0x01, // 63
+    0x01, 0x0D, 0xF0, 0x83, 0xC3, 0x18, 0x20, 0xF1, 0x9C, 0x31, 0x13, 0x64, 0xC2, 0xCC, 0x8F, 0x03, 0x5A, 0x40, 0x30, 0x0C, 0x7C, 0x00, // 64
+    0x01, 0x0C, 0x00, 0x0C, 0x78, 0xE0, 0xC1, 0x0B, 0x87, 0x70, 0x08, 0xBC, 0x00, 0x1E, 0x80, 0x07, 0xC0, // 65
+    0x01, 0x0C, 0xFF, 0x1F, 0x82, 0x21, 0x18, 0x82, 0x21, 0x18, 0xC6, 0xD7, 0xE7, 0x39, // 66
+    0x01, 0x0C, 0xF8, 0xC1, 0x3F, 0x06, 0x36, 0xC0, 0x01, 0x18, 0x80, 0x01, 0x38, 0x80, 0x03, 0x0C, // 67
+    0x01, 0x0C, 0xFF, 0x1F, 0x80, 0x01, 0x18, 0x80, 0x01, 0x38, 0xC0, 0x06, 0xC6, 0x3F, 0xF8, 0x01, // 68
+    0x01, 0x0C, 0xFF, 0x1F, 0x82, 0x21, 0x18, 0x82, 0x21, 0x18, 0x82, // 69
+    0x01, 0x0C, 0xFF, 0x1F, 0x02, 0x21, 0x10, 0x02, 0x21, 0x10, 0x02, // 70
+    0x01, 0x0C, 0xF8, 0xC1, 0x3F, 0x06, 0x36, 0xC0, 0x01, 0x18, 0x80, 0x41, 0x18, 0x84, 0x43, 0x08, 0xFC, // 71
+    0x01, 0x0C, 0xFF, 0x0F, 0x02, 0x20, 0x00, 0x02, 0x20, 0x00, 0x02, 0x20, 0xF0, 0xFF, // 72
+    0x01, 0x0C, 0x01, 0xF8, 0xFF, 0x01, 0x18, 0x80, // 73
+    0x01, 0x0F, 0x00, 0xE0, 0xFF, 0x1F, // 74
+    0x01, 0x0C, 0xFF, 0x0F, 0x04, 0x20, 0x00, 0x07, 0xCC, 0x61, 0x30, 0x03, 0x1E, 0x80, // 75
+    0x01, 0x0C, 0xFF, 0x0F, 0x80, 0x00, 0x08, 0x80, 0x00, 0x08, 0x80, 0x00, 0x08, // 76
+    0x01, 0x0C, 0xFF, 0x3F, 0x00, 0x1E, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x80, 0x03, 0x07, 0x0E, 0x10, 0x00, 0xFF, 0x0F, // 77
+    0x01, 0x0C, 0xFF, 0x3F, 0x00, 0x0E, 0x80, 0x01, 0x60, 0x00, 0x18, 0x00, 0x07, 0xC0, 0xFF, 0x0F, // 78
+    0x01, 0x0C, 0xF8, 0xE1, 0x7F, 0x02, 0x34, 0x80, 0x01, 0x18, 0x80, 0x01, 0x28, 0x40, 0xFE, 0x87, 0x1F, // 79
+    0x01, 0x0C, 0xFF, 0x1F, 0x04, 0x41, 0x10, 0x04, 0x63, 0xE0, 0x03, 0x1E, 0x00, // 80
+    0x01, 0x0F, 0xF8, 0x01, 0xFF, 0x83, 0x00, 0x61, 0x00, 0x11, 0x80, 0x08, 0x40, 0x04, 0x60, 0x04, 0xE8, 0xFE, 0x47, 0xFC, 0x00, // 81
+    0x01, 0x0C, 0xFF, 0x1F, 0x04, 0x41, 0x10, 0x04, 0xE3, 0xE1, 0x33, 0x1E, 0x0E, 0x80, // 82
+    0x01, 0x0C, 0x1E, 0xFC, 0x83, 0x21, 0x18, 0x86, 0x41, 0x38, 0x6C, 0x81, 0x03, // 83
+    0x01, 0x0C, 0x01, 0x10, 0x00, 0x01, 0xF0, 0xFF, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, // 84
+    0x01, 0x0C, 0xFF, 0x03, 0x60, 0x00, 0x0C, 0x80, 0x00, 0x08, 0xC0, 0x00, 0xF7, 0x3F, // 85
+    0x01, 0x0C, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0x78, 0x00, 0x08, 0x78, 0xF0, 0xE0, 0x01, 0x03, 0x00, // 86
+    0x01, 0x0C, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0x80, 0xE0, 0xE7, 0x03, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0xE0, 0xE7, 0x07, 0x07, 0x00, // 87
+    0x01, 0x0C, 0x01, 0x78, 0x60, 0x9C, 0x03, 0x0F, 0xF0, 0xC0, 0x39, 0x07, 0x1E, 0x80, // 88
+    0x01, 0x0C, 0x07, 0xC0, 0x01, 0x70, 0x00, 0xFC, 0x70, 0xC0, 0x01, 0x07, 0x10, 0x00, // 89
+    0x01, 0x0C, 0x01, 0x1C, 0xE0, 0x81, 0x19, 0x8C, 0x31, 0x98, 0x81, 0x07, 0x38, 0x80, // 90
+    0x01, 0x0F, 0xFF, 0xFF, 0x00, 0x60, 0x00, 0x10, // 91
+    0x01, 0x0C, 0x03, 0xE0, 0x00, 0x78, 0x00, 0x1C, 0x00, 0x07, 0x80, // 92
+    0x01, 0x0F, 0x01, 0xC0, 0x00, 0xE0, 0xFF, 0x1F, // 93
+    0x01, 0x07, 0x40, 0x38, 0xC6, 0x30, 0x30, 0x60, 0xE0, 0x40, // 94
+    0x0E, 0x01, 0x7F, // 95
+    0x00, 0x03, 0x19, 0x01, // 96
+    0x04, 0x09, 0xE0, 0x66, 0x47, 0x8C, 0x18, 0x71, 0x9A, 0x7F, // 97
+    0x00, 0x0D, 0xFF, 0x1F, 0x8C, 0x41, 0x40, 0x08, 0x08, 0x01, 0xC1, 0x1D, 0xF0, 0x01, // 98
+    0x04, 0x09, 0x7C, 0xDC, 0x0D, 0x0E, 0x18, 0x70, 0x30, // 99
+    0x00, 0x0D, 0xC0, 0x07, 0xDC, 0x41, 0x40, 0x08, 0x08, 0x01, 0xC1, 0xD8, 0xFF, 0x07, // 100
+    0x04, 0x09, 0x7C, 0xBC, 0x4D, 0x8E, 0x18, 0xD1, 0x22, 0x27, // 101
+    0x00, 0x0D, 0x10, 0xC0, 0xFF, 0x4F, 0x80, 0x08, 0x00, // 102
+    0x04, 0x0D, 0x00, 0xCE, 0x7B, 0xCF, 0xC5, 0x90, 0x18, 0x12, 0x67, 0xE2, 0xC7, 0x0A, 0x70, // 103
+    0x00, 0x0D, 0xFF, 0x1F, 0x0C, 0x40, 0x00, 0x08, 0x00, 0x01, 0x60, 0x00, 0xF8, 0x07, // 104
+    0x01, 0x0C, 0xFB, 0x0F, // 105
+    0x01, 0x10, 0x00, 0x80, 0xFB, 0xFF, // 106
+    0x00, 0x0D, 0xFF, 0x1F, 0x60, 0x00, 0x06, 0xE0, 0x01, 0x66, 0x60, 0x30, 0x04, 0x04, // 107
+    0x00, 0x0D, 0xFF, 0x1F, // 108
+    0x04, 0x09, 0xFF, 0x0D, 0x04, 0x08, 0x10, 0xE0, 0xBF, 0xFF, 0x01, 0x01, 0x02, 0x0C, 0xF0, 0x0F, // 109
+    0x04, 0x09, 0xFF, 0x0D, 0x04, 0x08, 0x10, 0x60, 0x80, 0x7F, // 110
+    0x04, 0x09, 0x7C, 0xDC, 0x05, 0x0C, 0x18, 0xD0, 0x1D, 0x1F, // 111
+    0x04, 0x0D, 0xFF, 0xDF, 0x18, 0x04, 0x84, 0x80, 0x10, 0x10, 0xDC, 0x01, 0x1F, 0x00, // 112
+    0x04, 0x0D, 0x7C, 0xC0, 0x1D, 0x04, 0x84, 0x80, 0x10, 0x10, 0x8C, 0xC1, 0xFF, 0x07, // 113
+    0x04, 0x09, 0xFF, 0x09, 0x0C, 0x08, 0x10, 0x00, // 114
+    0x04, 0x09, 0x8E, 0x37, 0x46, 0x8C, 0x3D, 0x0E, // 115
+    0x02, 0x0B, 0x04, 0xF8, 0x1F, 0x81, 0x09, 0x48, 0x40, // 116
+    0x04, 0x09, 0xFF, 0x00, 0x03, 0x04, 0x08, 0x10, 0xD8, 0x7F, // 117
+    0x04, 0x09, 0x03, 0x3C, 0xC0, 0x01, 0x0E, 0x1C, 0x8F, 0x87, 0x01, // 118
+    0x04, 0x09, 0x07, 0xFC, 0x80, 0x07, 0x8E, 0xE7, 0xC0, 0x01, 0x3E, 0xC0, 0xC1, 0xFB, 0x39, 0x00, // 119
+    0x04, 0x09, 0x01, 0x07, 0x9B, 0xC3, 0x81, 0xC3, 0xDC, 0xE0, 0x80, // 120
+    0x04, 0x0D, 0x03, 0xD0, 0x01, 0xE2, 0x61, 0xE0, 0x07, 0x3C, 0xF0, 0x80, 0x07, 0x18, 0x00, // 121
+    0x04, 0x09, 0x81, 0x83, 0xC7, 0xCD, 0x78, 0x70, 0x20, // 122
+    0x01, 0x0F, 0x80, 0x00, 0xC0, 0x80, 0xDF, 0x6F, 0x00, 0x1C, 0x00, 0x04, // 123
+    0x00, 0x11, 0xFF, 0xFF, 0x01, // 124
+    0x01, 0x0F, 0x01, 0xC0, 0x01, 0xB0, 0xDF, 0x0F, 0x30, 0x00, 0x08, 0x00, // 125
+    0x06, 0x03, 0x4A, 0x44, 0x0A, // 126
+    0x01, 0x0C, 0xFF, 0x1F, 0x80, 0x01, 0x18, 0x80, 0x01, 0x18, 0x80, 0xFF, 0x0F // 127
+
+};
+
+#endif
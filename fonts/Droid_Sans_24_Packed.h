@@ -0,0 +1,148 @@
+
+
+/*
+ *
+ * Droid_Sans_24_Packed
+ *
+ * DMD2 packed font, converted from Droid_Sans_24.h by extras/fontpack.py
+ * (see there for the format)
+ *
+ * Font size in bytes  : 2201 (3890 unpacked)
+ * Font width          : 10
+ * Font height         : 25
+ * Font first char     : 32
+ * Font used chars     : 96
+ */
+
+#include <inttypes.h>
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#elif defined (ESP8266)
+#include <pgmspace.h>
+#else
+#define PROGMEM
+#endif
+
+#ifndef DROID_SANS_24_PACKED_H
+#define DROID_SANS_24_PACKED_H
+
+static const uint8_t Droid_Sans_24_Packed[] PROGMEM = {
+    0xFF, 0xFF, // packed font
+    0x0A, // width
+    0x19, // height
+    0x20, // first char
+    0x60, // char count
+
+    // char widths
+    0x00, 0x03, 0x07, 0x0E, 0x0A, 0x12, 0x10, 0x02, 0x06, 0x06,
+    0x0A, 0x0B, 0x04, 0x06, 0x03, 0x09, 0x0B, 0x06, 0x0B, 0x0B,
+    0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x03, 0x04, 0x0B, 0x0B,
+    0x0B, 0x09, 0x12, 0x0E, 0x0B, 0x0C, 0x0C, 0x09, 0x09, 0x0E,
+    0x0C, 0x06, 0x04, 0x0C, 0x09, 0x10, 0x0D, 0x0F, 0x0A, 0x0F,
+    0x0B, 0x0A, 0x0C, 0x0C, 0x0D, 0x14, 0x0C, 0x0C, 0x0A, 0x05,
+    0x09, 0x05, 0x0D, 0x0A, 0x05, 0x0A, 0x0B, 0x09, 0x0B, 0x0B,
+    0x07, 0x0C, 0x0A, 0x02, 0x04, 0x0A, 0x02, 0x12, 0x0A, 0x0C,
+    0x0B, 0x0B, 0x08, 0x09, 0x08, 0x0A, 0x0C, 0x12, 0x0C, 0x0C,
+    0x09, 0x07, 0x02, 0x07, 0x0B, 0x0A,
+
+    // glyphs: top row, rows, column bits
+    0x00, 0x00, // 32
+    0x02, 0x11, 0xFF, 0xC1, 0xFF, 0x9F, 0xFF, 0x00, 0x07, // 33
+    0x02, 0x06, 0xFF, 0x0F, 0x00, 0xC0, 0xFF, 0x03, // 34
+    0x02, 0x11, 0x00, 0x0C, 0xC0, 0x18, 0x80, 0x31, 0x07, 0xFB, 0x8F, 0xFF, 0xE0, 0x8F, 0x41, 0x18, 0x03, 0x30, 0x86, 0x60, 0xFC, 0xC1, 0x7F, 0xFC, 0x37, 0x38, 0x63, 0x00, 0xC6, 0x00, 0x0C, 0x00, // 35
+    0x01, 0x14, 0xF0, 0xC0, 0x80, 0x1F, 0x18, 0x9C, 0x83, 0xC1, 0x30, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x86, 0xC1, 0xE0, 0x0C, 0x0C, 0xFC, 0x00, 0x80, 0x07, // 36
+    0x02, 0x11, 0xFC, 0x00, 0xFC, 0x03, 0x0C, 0x0C, 0x18, 0x18, 0x38, 0x30, 0xDC, 0x3F, 0x1C, 0x3F, 0x0E, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x03, 0xC0, 0xF1, 0xE3, 0xF0, 0xEF, 0x30, 0x70, 0x60, 0x60, 0xC0, 0xC0, 0x00, 0xFF, 0x00, 0xFC, 0x00, // 37
+    0x02, 0x11, 0x00, 0x7C, 0x00, 0xFC, 0xF1, 0x18, 0xF3, 0x1B, 0x7C, 0x1E, 0x78, 0x38, 0xF0, 0xF0, 0xE0, 0xE1, 0xC3, 0x67, 0x8E, 0x7D, 0xB8, 0x71, 0xE0, 0x03, 0x80, 0x03, 0xC0, 0x0F, 0xC0, 0x3B, 0x80, 0x61, 0x00, 0x80, // 38
+    0x02, 0x06, 0xFF, 0x0F, // 39
+    0x02, 0x15, 0xC0, 0x7F, 0x00, 0xFF, 0x7F, 0xF0, 0x01, 0x9F, 0x07, 0x00, 0x3F, 0x00, 0x80, 0x03, 0x00, 0x20, // 40
+    0x02, 0x15, 0x01, 0x00, 0x70, 0x00, 0x00, 0x3F, 0x00, 0x78, 0x7E, 0xE0, 0x03, 0xFF, 0x3F, 0x80, 0xFF, 0x00, // 41
+    0x01, 0x0B, 0x30, 0x80, 0x11, 0xCC, 0x61, 0xFF, 0x8F, 0x7F, 0xC0, 0x0E, 0xE6, 0x30, 0x82, 0x01, // 42
+    0x05, 0x0B, 0x60, 0x00, 0x03, 0x18, 0xC0, 0x00, 0x86, 0xFF, 0xFF, 0x1F, 0x0C, 0x60, 0x00, 0x03, 0x18, 0x00, // 43
+    0x10, 0x06, 0xF0, 0xFF, 0x0C, // 44
+    0x0C, 0x02, 0xFF, 0x0F, // 45
+    0x10, 0x03, 0xFF, 0x01, // 46
+    0x02, 0x11, 0x00, 0x80, 0x01, 0xC0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0x7C, 0x00, 0x1F, 0x80, 0x0F, 0x80, 0x07, 0x00, 0x01, 0x00, 0x00, // 47
+    0x02, 0x11, 0xF0, 0x1F, 0xF8, 0xFF, 0x78, 0xC0, 0x3B, 0x00, 0x3E, 0x00, 0x78, 0x00, 0xF0, 0x00, 0xE0, 0x03, 0xE0, 0x1E, 0xF0, 0xF8, 0xFF, 0xC0, 0x7F, 0x00, // 48
+    0x02, 0x11, 0x08, 0x00, 0x38, 0x00, 0x38, 0x00, 0x30, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x3F, // 49
+    0x02, 0x11, 0x04, 0x80, 0x0D, 0x80, 0x1F, 0x80, 0x1F, 0x80, 0x3D, 0xC0, 0x79, 0xC0, 0xF1, 0xC0, 0x61, 0xE3, 0xC1, 0xFE, 0x81, 0xF9, 0x00, 0x03, 0x00, 0x06, // 50
+    0x02, 0x11, 0x02, 0xC0, 0x0C, 0x00, 0x0F, 0x00, 0x1E, 0x0C, 0x3C, 0x18, 0x78, 0x30, 0xF0, 0x70, 0xE0, 0xB3, 0xE0, 0x7E, 0xE3, 0x78, 0xFC, 0x01, 0xF0, 0x00, // 51
+    0x02, 0x11, 0x00, 0x18, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0xCE, 0x00, 0x8E, 0x01, 0x07, 0x03, 0x07, 0x86, 0x03, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x60, 0x00, 0xC0, 0x00, 0x80, 0x01, // 52
+    0x02, 0x11, 0xFE, 0xC0, 0xFE, 0x01, 0x0F, 0x03, 0x1E, 0x06, 0x3C, 0x0C, 0x78, 0x18, 0xF0, 0x30, 0xE0, 0xE1, 0x60, 0x83, 0xE3, 0x06, 0xFE, 0x00, 0xF8, 0x00, // 53
+    0x02, 0x11, 0xE0, 0x1F, 0xF0, 0xFF, 0xF0, 0x8C, 0x33, 0x04, 0x6E, 0x0C, 0x78, 0x18, 0xF0, 0x30, 0xE0, 0x61, 0xC0, 0x83, 0xE1, 0x06, 0xFF, 0x01, 0xF8, 0x00, // 54
+    0x02, 0x11, 0x03, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x1E, 0x00, 0x3F, 0x80, 0x6F, 0xC0, 0xC7, 0xE0, 0x83, 0xF1, 0x00, 0x7F, 0x00, 0x3E, 0x00, 0x1C, 0x00, 0x00, // 55
+    0x02, 0x11, 0x00, 0x78, 0x78, 0xFC, 0xF9, 0x19, 0x3B, 0x1E, 0x3C, 0x1C, 0x78, 0x30, 0xF0, 0x70, 0xE0, 0xF3, 0xC1, 0x7E, 0xC6, 0x78, 0xFC, 0x01, 0xE0, 0x01, // 56
+    0x02, 0x11, 0xF8, 0x00, 0xFC, 0x07, 0x3B, 0x0C, 0x1E, 0x30, 0x3C, 0x60, 0x78, 0xC0, 0xF0, 0x80, 0xA1, 0x03, 0x61, 0x0E, 0x79, 0xF8, 0x7F, 0xC0, 0x3F, 0x00, // 57
+    0x06, 0x0D, 0x07, 0xFC, 0x80, 0x1F, 0x70, // 58
+    0x06, 0x10, 0x00, 0xC0, 0x07, 0xFC, 0x07, 0x3C, 0x07, 0x0C, // 59
+    0x05, 0x0C, 0x60, 0x00, 0x06, 0xF0, 0x00, 0x09, 0x98, 0x81, 0x10, 0x0C, 0xC3, 0x30, 0x06, 0x66, 0x60, 0x03, 0x0C, // 60
+    0x08, 0x06, 0xF3, 0x3C, 0xCF, 0xF3, 0x3C, 0xCF, 0xF3, 0x3C, 0x03, // 61
+    0x05, 0x0C, 0x03, 0x6C, 0x60, 0x06, 0xC6, 0x30, 0x0C, 0x83, 0x10, 0x98, 0x01, 0x09, 0xF0, 0x00, 0x06, 0x60, 0x00, // 62
+    0x02, 0x11, 0x02, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x1F, 0x70, 0x3E, 0xF0, 0x7C, 0x70, 0xC0, 0x71, 0x00, 0x7F, 0x00, 0x7C, 0x00, 0x00, // 63
+    0x02, 0x13, 0x80, 0x3F, 0x80, 0xFF, 0x07, 0x0E, 0x70, 0x18, 0x00, 0x67, 0x00, 0x30, 0xC3, 0x07, 0x0B, 0x7F, 0x78, 0x18, 0xC6, 0x63, 0x30, 0x1E, 0x83, 0xF1, 0x18, 0x84, 0xC7, 0x1F, 0x3C, 0xFE, 0x61, 0x03, 0x18, 0x19, 0xC0, 0x80, 0x03, 0x06, 0xF8, 0x1F, 0x00, 0x3F, 0x00, // 64
+    0x02, 0x11, 0x00, 0x80, 0x01, 0xE0, 0x03, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0xC0, 0x8F, 0xC1, 0x03, 0x83, 0x07, 0x06, 0x7E, 0x0C, 0xE0, 0x1F, 0x00, 0x7E, 0x00, 0xE0, 0x07, 0x00, 0x1F, 0x00, 0x30, // 65
+    0x02, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x06, 0x1E, 0x0C, 0x3C, 0x18, 0x78, 0x30, 0xF0, 0x60, 0xE0, 0xE1, 0xC0, 0x7E, 0xE7, 0xFC, 0xFC, 0x61, 0xF0, 0x00, // 66
+    0x02, 0x11, 0xE0, 0x0F, 0xF0, 0x7F, 0xF0, 0xE1, 0x71, 0x00, 0x67, 0x00, 0x6C, 0x00, 0xF0, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0F, 0x00, 0x16, 0x00, 0x04, // 67
+    0x02, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x60, 0x03, 0x60, 0x0E, 0xE0, 0x78, 0xF8, 0xE0, 0xFF, 0x00, 0x7F, 0x00, // 68
+    0x02, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x06, 0x1E, 0x0C, 0x3C, 0x18, 0x78, 0x30, 0xF0, 0x60, 0xE0, 0xC1, 0xC0, 0x83, 0x81, 0x01, // 69
+    0x02, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x06, 0x18, 0x0C, 0x30, 0x18, 0x60, 0x30, 0xC0, 0x60, 0x80, 0xC1, 0x00, 0x83, 0x01, 0x00, // 70
+    0x02, 0x11, 0xE0, 0x0F, 0xF0, 0x7F, 0xF0, 0xE1, 0x71, 0x00, 0x67, 0x00, 0x6C, 0x00, 0xF0, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x83, 0x07, 0x06, 0x0F, 0x0C, 0x1E, 0x18, 0x6C, 0xF0, 0x1F, 0xE0, 0x1F, // 71
+    0x02, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0xC0, 0x00, 0x80, 0x01, 0x00, 0x03, 0xFC, 0xFF, 0xFF, 0xFF, 0x0F, // 72
+    0x02, 0x11, 0x01, 0x00, 0x07, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x38, 0x00, 0x20, // 73
+    0x02, 0x16, 0x00, 0x00, 0x30, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFD, 0xFF, 0x3F, // 74
+    0x02, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x0C, 0x00, 0x0C, 0x00, 0x3C, 0x00, 0xFC, 0x00, 0x8C, 0x03, 0x0C, 0x1E, 0x0E, 0x70, 0x0E, 0xC0, 0x0F, 0x00, 0x0E, 0x00, 0x08, // 75
+    0x02, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0xC0, 0x00, 0x80, 0x01, // 76
+    0x02, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0xF8, 0x03, 0x80, 0x3F, 0x00, 0xF8, 0x03, 0x80, 0x3F, 0x00, 0xF8, 0x00, 0xF0, 0x01, 0xFC, 0x00, 0x3E, 0x80, 0x0F, 0xE0, 0x03, 0xE0, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, // 77
+    0x02, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0xF0, 0x00, 0x80, 0x07, 0x00, 0x3C, 0x00, 0xE0, 0x00, 0x80, 0x07, 0x00, 0x3C, 0x00, 0xE0, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, // 78
+    0x02, 0x11, 0xE0, 0x0F, 0xF0, 0x7F, 0xF0, 0xE0, 0x71, 0x00, 0x67, 0x00, 0x6C, 0x00, 0xF0, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x1B, 0x00, 0x73, 0x00, 0xC7, 0x83, 0x07, 0xFF, 0x07, 0xF8, 0x03, // 79
+    0x02, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x0C, 0x18, 0x18, 0x30, 0x30, 0x60, 0x60, 0xC0, 0xC0, 0x00, 0xE7, 0x00, 0xFE, 0x01, 0xF8, 0x00, 0x00, // 80
+    0x02, 0x15, 0xE0, 0x0F, 0x00, 0xFF, 0x07, 0xF0, 0xE0, 0x01, 0x07, 0x70, 0x60, 0x00, 0x0C, 0x06, 0x00, 0xC3, 0x00, 0x60, 0x18, 0x00, 0x0C, 0x03, 0x80, 0x61, 0x00, 0x70, 0x18, 0x00, 0x3F, 0x07, 0x70, 0xCE, 0x83, 0x87, 0xF1, 0x7F, 0x20, 0xF8, 0x03, 0x00, // 81
+    0x02, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x0C, 0x18, 0x18, 0x30, 0x30, 0x60, 0xE0, 0xC0, 0xC0, 0x07, 0xE7, 0x1C, 0xFE, 0xF0, 0xF8, 0x80, 0x03, 0x00, 0x04, // 82
+    0x02, 0x11, 0x7C, 0xC0, 0xFC, 0x01, 0x1B, 0x03, 0x1E, 0x0C, 0x3C, 0x18, 0x78, 0x60, 0xF0, 0xC0, 0xE0, 0x81, 0x63, 0x07, 0xFE, 0x00, 0xF8, 0x00, // 83
+    0x02, 0x11, 0x03, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x30, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x03, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x00, // 84
+    0x02, 0x11, 0xFF, 0x3F, 0xFE, 0xFF, 0x00, 0x80, 0x03, 0x00, 0x0E, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0xC0, 0x00, 0xC0, 0x01, 0xC0, 0xFD, 0xFF, 0xF9, 0xFF, 0x01, // 85
+    0x02, 0x11, 0x03, 0x00, 0x3E, 0x00, 0xF8, 0x03, 0x00, 0x3F, 0x00, 0xF0, 0x03, 0x00, 0x3F, 0x00, 0x60, 0x00, 0xFC, 0x00, 0x3F, 0xC0, 0x0F, 0xF8, 0x03, 0xF8, 0x00, 0x30, 0x00, 0x00, // 86
+    0x02, 0x11, 0x07, 0x00, 0x7E, 0x00, 0xF0, 0x0F, 0x00, 0xFE, 0x01, 0xC0, 0x1F, 0x00, 0x30, 0x80, 0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0x3E, 0x00, 0x7C, 0x00, 0xE0, 0x0F, 0x00, 0xFC, 0x01, 0x80, 0x3F, 0x00, 0x70, 0x00, 0xFF, 0xE0, 0x1F, 0xF8, 0x07, 0xFC, 0x00, 0x38, 0x00, 0x00, // 87
+    0x02, 0x11, 0x01, 0x00, 0x0F, 0x80, 0x3B, 0xC0, 0xE3, 0xE1, 0x01, 0xEF, 0x00, 0xF8, 0x00, 0xF0, 0x01, 0xF8, 0x0F, 0x3C, 0x3C, 0x1C, 0xE0, 0x1D, 0x00, 0x0F, 0x00, 0x08, // 88
+    0x02, 0x11, 0x03, 0x00, 0x1E, 0x00, 0xF8, 0x00, 0xC0, 0x07, 0x00, 0x3E, 0x00, 0xF0, 0x3F, 0xC0, 0x7F, 0xF0, 0x01, 0xF8, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x18, 0x00, 0x00, // 89
+    0x02, 0x11, 0x03, 0x80, 0x07, 0xC0, 0x0F, 0xE0, 0x1F, 0xF0, 0x3C, 0xF8, 0x78, 0x7C, 0xF0, 0x3C, 0xE0, 0x1F, 0xC0, 0x0F, 0x80, 0x07, 0x00, 0x03, // 90
+    0x02, 0x15, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0xE0, 0x01, 0x00, 0x3C, 0x00, 0x80, 0x01, // 91
+    0x02, 0x11, 0x03, 0x00, 0x1E, 0x00, 0xF0, 0x01, 0x80, 0x0F, 0x00, 0x7C, 0x00, 0xC0, 0x07, 0x00, 0x3E, 0x00, 0xF0, 0x00, 0x00, 0x01, // 92
+    0x02, 0x15, 0x03, 0x00, 0x78, 0x00, 0x00, 0x0F, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, // 93
+    0x02, 0x0B, 0x00, 0x04, 0x38, 0xF0, 0xE0, 0x81, 0x03, 0x07, 0x0C, 0xE0, 0x01, 0x3C, 0x80, 0x07, 0xF0, 0x00, 0x0E, 0x40, // 94
+    0x15, 0x02, 0xFF, 0xFF, 0x0F, // 95
+    0x00, 0x04, 0x31, 0xE7, 0x08, // 96
+    0x06, 0x0D, 0x80, 0x47, 0xF8, 0x0D, 0xF3, 0x31, 0x3C, 0x86, 0xC7, 0xF0, 0x18, 0x3A, 0x63, 0xFE, 0x9F, 0xFF, 0x03, // 97
+    0x01, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x1C, 0x1C, 0x10, 0x40, 0x60, 0x00, 0x83, 0x01, 0x0C, 0x06, 0x30, 0x18, 0xC0, 0xC0, 0xC1, 0x01, 0xFE, 0x03, 0xF0, 0x07, // 98
+    0x06, 0x0D, 0xF8, 0x83, 0xFF, 0x38, 0xB8, 0x03, 0x3C, 0x80, 0x07, 0xF0, 0x00, 0x1E, 0xC0, 0x02, 0x08, // 99
+    0x01, 0x12, 0x00, 0x7F, 0x00, 0xFE, 0x03, 0x1C, 0x1C, 0x18, 0xC0, 0x60, 0x00, 0x83, 0x01, 0x0C, 0x06, 0x30, 0x10, 0x40, 0xC0, 0xC1, 0xFD, 0xFF, 0xFF, 0xFF, 0x3F, // 100
+    0x06, 0x0D, 0xF0, 0x81, 0xFF, 0xB8, 0xB9, 0x31, 0x3E, 0x86, 0xC7, 0xF0, 0x18, 0x1E, 0xC3, 0x66, 0xD8, 0x0F, 0xE3, 0x01, // 101
+    0x01, 0x12, 0x40, 0x00, 0x80, 0x01, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x63, 0x00, 0x8C, 0x01, 0x30, 0x06, 0x00, // 102
+    0x06, 0x13, 0x00, 0xC0, 0xE1, 0x03, 0x9F, 0xBF, 0x8F, 0x8F, 0x3F, 0x3C, 0x98, 0xE1, 0xC1, 0x0C, 0x0F, 0x66, 0x78, 0x30, 0xC3, 0xC7, 0x19, 0xFE, 0xC7, 0xD8, 0x1F, 0xFC, 0x06, 0xC0, 0x03, // 103
+    0x01, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x1C, 0x00, 0x10, 0x00, 0x60, 0x00, 0x80, 0x01, 0x00, 0x06, 0x00, 0x38, 0x00, 0xC0, 0xFF, 0x03, 0xFE, 0x0F, // 104
+    0x01, 0x12, 0xE7, 0xFF, 0x9F, 0xFF, 0x0F, // 105
+    0x01, 0x18, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0x7F, // 106
+    0x01, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x80, 0x01, 0x00, 0x03, 0x00, 0x1F, 0x00, 0xEE, 0x01, 0x1C, 0x0E, 0x38, 0xF0, 0x60, 0x00, 0x83, 0x00, 0x08, // 107
+    0x01, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, // 108
+    0x06, 0x0D, 0xFF, 0xFF, 0xFF, 0x3B, 0x00, 0x01, 0x30, 0x00, 0x06, 0xC0, 0x00, 0x38, 0x00, 0xFE, 0x9F, 0xFF, 0x3B, 0x00, 0x01, 0x30, 0x00, 0x06, 0xC0, 0x00, 0x38, 0x00, 0xFE, 0x9F, 0xFF, 0x03, // 109
+    0x06, 0x0D, 0xFF, 0xFF, 0xFF, 0x3B, 0x00, 0x01, 0x30, 0x00, 0x06, 0xC0, 0x00, 0x38, 0x00, 0xFE, 0x9F, 0xFF, 0x03, // 110
+    0x06, 0x0D, 0xF8, 0x81, 0xFF, 0x38, 0xB8, 0x03, 0x3E, 0x80, 0x07, 0xF0, 0x00, 0x1E, 0xC0, 0x07, 0xDC, 0xC1, 0xF1, 0x1F, 0xF8, 0x00, // 111
+    0x06, 0x13, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x83, 0x03, 0x04, 0x10, 0x30, 0x80, 0x81, 0x01, 0x0C, 0x0C, 0x60, 0x60, 0x00, 0x03, 0x0E, 0x0E, 0xE0, 0x3F, 0x00, 0xFE, 0x00, 0x00, // 112
+    0x06, 0x13, 0xF8, 0x03, 0xE0, 0x3F, 0x80, 0x83, 0x03, 0x06, 0x30, 0x30, 0x80, 0x81, 0x01, 0x0C, 0x0C, 0x60, 0x40, 0x00, 0x01, 0x0C, 0x0E, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, // 113
+    0x06, 0x0D, 0xFF, 0xFF, 0xFF, 0x33, 0x00, 0x03, 0x30, 0x00, 0x06, 0xC0, 0x00, 0x18, 0x00, // 114
+    0x06, 0x0D, 0x1C, 0xC8, 0x07, 0xCF, 0xE1, 0x31, 0x3C, 0x86, 0x87, 0xF1, 0x70, 0x1F, 0x7C, 0x02, 0x07, // 115
+    0x03, 0x10, 0x18, 0x00, 0x18, 0x00, 0xFE, 0x3F, 0xFF, 0x7F, 0x18, 0xC0, 0x18, 0xC0, 0x18, 0xC0, 0x18, 0xC0, // 116
+    0x06, 0x0D, 0xFF, 0xE7, 0xFF, 0x01, 0x70, 0x00, 0x0C, 0x80, 0x01, 0x30, 0x00, 0x02, 0x70, 0xFF, 0xFF, 0xFF, 0x03, // 117
+    0x06, 0x0D, 0x03, 0xE0, 0x03, 0xF8, 0x01, 0xF8, 0x01, 0xF8, 0x01, 0x38, 0x00, 0x07, 0xFC, 0xF0, 0xC3, 0x0F, 0x7C, 0x80, 0x01, 0x00, // 118
+    0x06, 0x0D, 0x07, 0xE0, 0x0F, 0xF0, 0x0F, 0xE0, 0x0F, 0x80, 0x01, 0x3E, 0xFC, 0xF1, 0x03, 0x0F, 0xE0, 0x01, 0xF8, 0x01, 0xF8, 0x03, 0xF0, 0x01, 0x30, 0xF0, 0xE7, 0x1F, 0x3F, 0xE0, 0x00, 0x00, // 119
+    0x06, 0x0D, 0x01, 0x70, 0x00, 0x1F, 0x78, 0x8F, 0x83, 0x3B, 0xE0, 0x03, 0x7C, 0xC0, 0x1D, 0x1E, 0xE7, 0x80, 0x0F, 0xE0, 0x00, 0x08, // 120
+    0x06, 0x13, 0x03, 0x00, 0x7E, 0x00, 0xB0, 0x1F, 0x80, 0xE1, 0x03, 0x0E, 0xF8, 0x38, 0x00, 0xFF, 0x00, 0xF8, 0x01, 0xF0, 0x01, 0xF0, 0x03, 0xF0, 0x03, 0xC0, 0x07, 0x00, 0x06, 0x00, 0x00, // 121
+    0x06, 0x0D, 0x03, 0x78, 0xC0, 0x0F, 0xFC, 0xE1, 0x3D, 0x8E, 0xF7, 0xF0, 0x07, 0x7E, 0xC0, 0x03, 0x18, // 122
+    0x02, 0x15, 0x00, 0x06, 0x00, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0xFF, 0xFF, 0xE3, 0x9F, 0xFF, 0x06, 0x00, 0xF0, 0x00, 0x00, 0x06, // 123
+    0x01, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, // 124
+    0x02, 0x15, 0x03, 0x00, 0x78, 0x00, 0x00, 0xFB, 0xE7, 0x3F, 0xFF, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x0C, 0x00, 0x80, 0x01, 0x00, // 125
+    0x09, 0x03, 0xDE, 0x36, 0xD9, 0xF6, 0x00, // 126
+    0x02, 0x11, 0xFF, 0xFF, 0x03, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0xC0, 0x00, 0x80, 0x01, 0x00, 0xFF, 0xFF, 0x03 // 127
+
+};
+
+#endif
@@ -0,0 +1,200 @@
+
+
+/*
+ *
+ * SystemFont5x7_Extended
+ *
+ * DMD2 sparse font, made by extras/fontsparse.py from SystemFont5x7.h and
+ * accented lowercase letters (U+00E0-U+00FC), degree and euro signs drawn
+ * to match (see fontsparse.py for the format)
+ *
+ * Font size in bytes  : 1001
+ * Font height         : 7
+ * Font used chars     : 120, in 7 ranges
+ */
+
+#include <inttypes.h>
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#elif defined (ESP8266)
+#include <pgmspace.h>
+#else
+#define PROGMEM
+#endif
+
+#ifndef SYSTEMFONT5X7_EXTENDED_H
+#define SYSTEMFONT5X7_EXTENDED_H
+
+static const uint8_t SystemFont5x7_Extended[] PROGMEM = {
+    0xFE, 0xFE, // sparse font
+    0x05, // space width
+    0x07, // height
+    0x00, // (unused)
+    0x07, // range count
+
+    // ranges: first char, char count, first glyph
+    0x21, 0x00, 0x5F, 0x00, 0x00, // U+0021-U+007F
+    0xB0, 0x00, 0x01, 0x5F, 0x00, // U+00B0-U+00B0
+    0xE0, 0x00, 0x05, 0x60, 0x00, // U+00E0-U+00E4
+    0xE8, 0x00, 0x08, 0x65, 0x00, // U+00E8-U+00EF
+    0xF1, 0x00, 0x06, 0x6D, 0x00, // U+00F1-U+00F6
+    0xF9, 0x00, 0x04, 0x73, 0x00, // U+00F9-U+00FC
+    0xAC, 0x20, 0x01, 0x77, 0x00, // U+20AC-U+20AC
+
+    // glyphs: width, data offset
+    0x05, 0x91, 0x01, 0x05, 0x96, 0x01, 0x05, 0x9B, 0x01, 0x05, 0xA0, 0x01, // U+0021
+    0x05, 0xA5, 0x01, 0x05, 0xAA, 0x01, 0x05, 0xAF, 0x01, 0x05, 0xB4, 0x01, // U+0025
+    0x05, 0xB9, 0x01, 0x05, 0xBE, 0x01, 0x05, 0xC3, 0x01, 0x05, 0xC8, 0x01, // U+0029
+    0x05, 0xCD, 0x01, 0x05, 0xD2, 0x01, 0x05, 0xD7, 0x01, 0x05, 0xDC, 0x01, // U+002D
+    0x05, 0xE1, 0x01, 0x05, 0xE6, 0x01, 0x05, 0xEB, 0x01, 0x05, 0xF0, 0x01, // U+0031
+    0x05, 0xF5, 0x01, 0x05, 0xFA, 0x01, 0x05, 0xFF, 0x01, 0x05, 0x04, 0x02, // U+0035
+    0x05, 0x09, 0x02, 0x05, 0x0E, 0x02, 0x05, 0x13, 0x02, 0x05, 0x18, 0x02, // U+0039
+    0x05, 0x1D, 0x02, 0x05, 0x22, 0x02, 0x05, 0x27, 0x02, 0x05, 0x2C, 0x02, // U+003D
+    0x05, 0x31, 0x02, 0x05, 0x36, 0x02, 0x05, 0x3B, 0x02, 0x05, 0x40, 0x02, // U+0041
+    0x05, 0x45, 0x02, 0x05, 0x4A, 0x02, 0x05, 0x4F, 0x02, 0x05, 0x54, 0x02, // U+0045
+    0x05, 0x59, 0x02, 0x05, 0x5E, 0x02, 0x05, 0x63, 0x02, 0x05, 0x68, 0x02, // U+0049
+    0x05, 0x6D, 0x02, 0x05, 0x72, 0x02, 0x05, 0x77, 0x02, 0x05, 0x7C, 0x02, // U+004D
+    0x05, 0x81, 0x02, 0x05, 0x86, 0x02, 0x05, 0x8B, 0x02, 0x05, 0x90, 0x02, // U+0051
+    0x05, 0x95, 0x02, 0x05, 0x9A, 0x02, 0x05, 0x9F, 0x02, 0x05, 0xA4, 0x02, // U+0055
+    0x05, 0xA9, 0x02, 0x05, 0xAE, 0x02, 0x05, 0xB3, 0x02, 0x05, 0xB8, 0x02, // U+0059
+    0x05, 0xBD, 0x02, 0x05, 0xC2, 0x02, 0x05, 0xC7, 0x02, 0x05, 0xCC, 0x02, // U+005D
+    0x05, 0xD1, 0x02, 0x05, 0xD6, 0x02, 0x05, 0xDB, 0x02, 0x05, 0xE0, 0x02, // U+0061
+    0x05, 0xE5, 0x02, 0x05, 0xEA, 0x02, 0x05, 0xEF, 0x02, 0x05, 0xF4, 0x02, // U+0065
+    0x05, 0xF9, 0x02, 0x05, 0xFE, 0x02, 0x05, 0x03, 0x03, 0x05, 0x08, 0x03, // U+0069
+    0x05, 0x0D, 0x03, 0x05, 0x12, 0x03, 0x05, 0x17, 0x03, 0x05, 0x1C, 0x03, // U+006D
+    0x05, 0x21, 0x03, 0x05, 0x26, 0x03, 0x05, 0x2B, 0x03, 0x05, 0x30, 0x03, // U+0071
+    0x05, 0x35, 0x03, 0x05, 0x3A, 0x03, 0x05, 0x3F, 0x03, 0x05, 0x44, 0x03, // U+0075
+    0x05, 0x49, 0x03, 0x05, 0x4E, 0x03, 0x05, 0x53, 0x03, 0x05, 0x58, 0x03, // U+0079
+    0x05, 0x5D, 0x03, 0x05, 0x62, 0x03, 0x05, 0x67, 0x03, 0x05, 0x6C, 0x03, // U+007D
+    0x05, 0x71, 0x03, 0x05, 0x76, 0x03, 0x05, 0x7B, 0x03, 0x05, 0x80, 0x03, // U+00E0
+    0x05, 0x85, 0x03, 0x05, 0x8A, 0x03, 0x05, 0x8F, 0x03, 0x05, 0x94, 0x03, // U+00E4
+    0x05, 0x99, 0x03, 0x05, 0x9E, 0x03, 0x05, 0xA3, 0x03, 0x05, 0xA8, 0x03, // U+00EB
+    0x05, 0xAD, 0x03, 0x05, 0xB2, 0x03, 0x05, 0xB7, 0x03, 0x05, 0xBC, 0x03, // U+00EF
+    0x05, 0xC1, 0x03, 0x05, 0xC6, 0x03, 0x05, 0xCB, 0x03, 0x05, 0xD0, 0x03, // U+00F4
+    0x05, 0xD5, 0x03, 0x05, 0xDA, 0x03, 0x05, 0xDF, 0x03, 0x05, 0xE4, 0x03, // U+00FA
+
+    // glyph data
+    0x00, 0x00, 0x5F, 0x00, 0x00, // U+0021 !
+    0x00, 0x07, 0x00, 0x07, 0x00, // U+0022 "
+    0x14, 0x7F, 0x14, 0x7F, 0x14, // U+0023 #
+    0x24, 0x2A, 0x7F, 0x2A, 0x12, // U+0024 $
+    0x23, 0x13, 0x08, 0x64, 0x62, // U+0025 %
+    0x36, 0x49, 0x55, 0x22, 0x50, // U+0026 &
+    0x00, 0x05, 0x03, 0x00, 0x00, // U+0027 '
+    0x00, 0x1C, 0x22, 0x41, 0x00, // U+0028 (
+    0x00, 0x41, 0x22, 0x1C, 0x00, // U+0029 )
+    0x08, 0x2A, 0x1C, 0x2A, 0x08, // U+002A *
+    0x08, 0x08, 0x3E, 0x08, 0x08, // U+002B +
+    0x00, 0x50, 0x30, 0x00, 0x00, // U+002C ,
+    0x08, 0x08, 0x08, 0x08, 0x08, // U+002D -
+    0x00, 0x60, 0x60, 0x00, 0x00, // U+002E .
+    0x20, 0x10, 0x08, 0x04, 0x02, // U+002F /
+    0x3E, 0x51, 0x49, 0x45, 0x3E, // U+0030 0
+    0x00, 0x42, 0x7F, 0x40, 0x00, // U+0031 1
+    0x42, 0x61, 0x51, 0x49, 0x46, // U+0032 2
+    0x21, 0x41, 0x45, 0x4B, 0x31, // U+0033 3
+    0x18, 0x14, 0x12, 0x7F, 0x10, // U+0034 4
+    0x27, 0x45, 0x45, 0x45, 0x39, // U+0035 5
+    0x3C, 0x4A, 0x49, 0x49, 0x30, // U+0036 6
+    0x01, 0x71, 0x09, 0x05, 0x03, // U+0037 7
+    0x36, 0x49, 0x49, 0x49, 0x36, // U+0038 8
+    0x06, 0x49, 0x49, 0x29, 0x1E, // U+0039 9
+    0x00, 0x36, 0x36, 0x00, 0x00, // U+003A :
+    0x00, 0x56, 0x36, 0x00, 0x00, // U+003B ;
+    0x00, 0x08, 0x14, 0x22, 0x41, // U+003C <
+    0x14, 0x14, 0x14, 0x14, 0x14, // U+003D =
+    0x41, 0x22, 0x14, 0x08, 0x00, // U+003E >
+    0x02, 0x01, 0x51, 0x09, 0x06, // U+003F ?
+    0x32, 0x49, 0x79, 0x41, 0x3E, // U+0040 @
+    0x7E, 0x11, 0x11, 0x11, 0x7E, // U+0041 A
+    0x7F, 0x49, 0x49, 0x49, 0x36, // U+0042 B
+    0x3E, 0x41, 0x41, 0x41, 0x22, // U+0043 C
+    0x7F, 0x41, 0x41, 0x22, 0x1C, // U+0044 D
+    0x7F, 0x49, 0x49, 0x49, 0x41, // U+0045 E
+    0x7F, 0x09, 0x09, 0x01, 0x01, // U+0046 F
+    0x3E, 0x41, 0x41, 0x51, 0x32, // U+0047 G
+    0x7F, 0x08, 0x08, 0x08, 0x7F, // U+0048 H
+    0x00, 0x41, 0x7F, 0x41, 0x00, // U+0049 I
+    0x20, 0x40, 0x41, 0x3F, 0x01, // U+004A J
+    0x7F, 0x08, 0x14, 0x22, 0x41, // U+004B K
+    0x7F, 0x40, 0x40, 0x40, 0x40, // U+004C L
+    0x7F, 0x02, 0x04, 0x02, 0x7F, // U+004D M
+    0x7F, 0x04, 0x08, 0x10, 0x7F, // U+004E N
+    0x3E, 0x41, 0x41, 0x41, 0x3E, // U+004F O
+    0x7F, 0x09, 0x09, 0x09, 0x06, // U+0050 P
+    0x3E, 0x41, 0x51, 0x21, 0x5E, // U+0051 Q
+    0x7F, 0x09, 0x19, 0x29, 0x46, // U+0052 R
+    0x46, 0x49, 0x49, 0x49, 0x31, // U+0053 S
+    0x01, 0x01, 0x7F, 0x01, 0x01, // U+0054 T
+    0x3F, 0x40, 0x40, 0x40, 0x3F, // U+0055 U
+    0x1F, 0x20, 0x40, 0x20, 0x1F, // U+0056 V
+    0x7F, 0x20, 0x18, 0x20, 0x7F, // U+0057 W
+    0x63, 0x14, 0x08, 0x14, 0x63, // U+0058 X
+    0x03, 0x04, 0x78, 0x04, 0x03, // U+0059 Y
+    0x61, 0x51, 0x49, 0x45, 0x43, // U+005A Z
+    0x00, 0x00, 0x7F, 0x41, 0x41, // U+005B [
+    0x02, 0x04, 0x08, 0x10, 0x20, // U+005C 
+    0x41, 0x41, 0x7F, 0x00, 0x00, // U+005D ]
+    0x04, 0x02, 0x01, 0x02, 0x04, // U+005E ^
+    0x40, 0x40, 0x40, 0x40, 0x40, // U+005F _
+    0x00, 0x01, 0x02, 0x04, 0x00, // U+0060 `
+    0x20, 0x54, 0x54, 0x54, 0x78, // U+0061 a
+    0x7F, 0x48, 0x44, 0x44, 0x38, // U+0062 b
+    0x38, 0x44, 0x44, 0x44, 0x20, // U+0063 c
+    0x38, 0x44, 0x44, 0x48, 0x7F, // U+0064 d
+    0x38, 0x54, 0x54, 0x54, 0x18, // U+0065 e
+    0x08, 0x7E, 0x09, 0x01, 0x02, // U+0066 f
+    0x08, 0x14, 0x54, 0x54, 0x3C, // U+0067 g
+    0x7F, 0x08, 0x04, 0x04, 0x78, // U+0068 h
+    0x00, 0x44, 0x7D, 0x40, 0x00, // U+0069 i
+    0x20, 0x40, 0x44, 0x3D, 0x00, // U+006A j
+    0x00, 0x7F, 0x10, 0x28, 0x44, // U+006B k
+    0x00, 0x41, 0x7F, 0x40, 0x00, // U+006C l
+    0x7C, 0x04, 0x18, 0x04, 0x78, // U+006D m
+    0x7C, 0x08, 0x04, 0x04, 0x78, // U+006E n
+    0x38, 0x44, 0x44, 0x44, 0x38, // U+006F o
+    0x7C, 0x14, 0x14, 0x14, 0x08, // U+0070 p
+    0x08, 0x14, 0x14, 0x18, 0x7C, // U+0071 q
+    0x7C, 0x08, 0x04, 0x04, 0x08, // U+0072 r
+    0x48, 0x54, 0x54, 0x54, 0x20, // U+0073 s
+    0x04, 0x3F, 0x44, 0x40, 0x20, // U+0074 t
+    0x3C, 0x40, 0x40, 0x20, 0x7C, // U+0075 u
+    0x1C, 0x20, 0x40, 0x20, 0x1C, // U+0076 v
+    0x3C, 0x40, 0x30, 0x40, 0x3C, // U+0077 w
+    0x44, 0x28, 0x10, 0x28, 0x44, // U+0078 x
+    0x0C, 0x50, 0x50, 0x50, 0x3C, // U+0079 y
+    0x44, 0x64, 0x54, 0x4C, 0x44, // U+007A z
+    0x00, 0x08, 0x36, 0x41, 0x00, // U+007B {
+    0x00, 0x00, 0x7F, 0x00, 0x00, // U+007C |
+    0x00, 0x41, 0x36, 0x08, 0x00, // U+007D }
+    0x08, 0x08, 0x2A, 0x1C, 0x08, // U+007E ~
+    0x08, 0x1C, 0x2A, 0x08, 0x08, // U+007F 
+    0x06, 0x09, 0x09, 0x06, 0x00, // U+00B0 °
+    0x20, 0x55, 0x56, 0x54, 0x78, // U+00E0 à
+    0x20, 0x54, 0x56, 0x55, 0x78, // U+00E1 á
+    0x20, 0x56, 0x55, 0x56, 0x78, // U+00E2 â
+    0x22, 0x55, 0x56, 0x55, 0x78, // U+00E3 ã
+    0x20, 0x55, 0x54, 0x55, 0x78, // U+00E4 ä
+    0x38, 0x55, 0x56, 0x54, 0x18, // U+00E8 è
+    0x38, 0x54, 0x56, 0x55, 0x18, // U+00E9 é
+    0x38, 0x56, 0x55, 0x56, 0x18, // U+00EA ê
+    0x38, 0x55, 0x54, 0x55, 0x18, // U+00EB ë
+    0x00, 0x45, 0x7E, 0x40, 0x00, // U+00EC ì
+    0x00, 0x44, 0x7E, 0x41, 0x00, // U+00ED í
+    0x00, 0x46, 0x7D, 0x42, 0x00, // U+00EE î
+    0x00, 0x45, 0x7C, 0x41, 0x00, // U+00EF ï
+    0x7E, 0x09, 0x06, 0x05, 0x78, // U+00F1 ñ
+    0x38, 0x45, 0x46, 0x44, 0x38, // U+00F2 ò
+    0x38, 0x44, 0x46, 0x45, 0x38, // U+00F3 ó
+    0x38, 0x46, 0x45, 0x46, 0x38, // U+00F4 ô
+    0x3A, 0x45, 0x46, 0x45, 0x38, // U+00F5 õ
+    0x38, 0x45, 0x44, 0x45, 0x38, // U+00F6 ö
+    0x3C, 0x41, 0x42, 0x20, 0x7C, // U+00F9 ù
+    0x3C, 0x40, 0x42, 0x21, 0x7C, // U+00FA ú
+    0x3C, 0x42, 0x41, 0x22, 0x7C, // U+00FB û
+    0x3C, 0x41, 0x40, 0x21, 0x7C, // U+00FC ü
+    0x14, 0x3E, 0x55, 0x55, 0x41 // U+20AC €
+
+};
+
+#endif